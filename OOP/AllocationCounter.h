@@ -0,0 +1,29 @@
+#ifndef ALLOCATIONCOUNTER_H
+#define ALLOCATIONCOUNTER_H
+
+// Contador de reservas de memoria por hilo, para comprobar que ProcessEvent no reserva
+// memoria en regimen estacionario. Solo se activa compilando con -DBTAG_COUNT_ALLOCS:
+// sustituye el operator new global, asi que este archivo debe incluirse en una sola
+// unidad de compilacion (JetAnalyzer.cpp, incluido desde main.cpp).
+#ifdef BTAG_COUNT_ALLOCS
+
+#include <Rtypes.h>
+#include <cstdlib>
+#include <new>
+
+namespace AllocationCounter {
+inline thread_local Long64_t count = 0;
+}
+
+__attribute__((noinline)) void* operator new(std::size_t size) {
+    AllocationCounter::count++;
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+__attribute__((noinline)) void operator delete(void* p) noexcept { std::free(p); }
+__attribute__((noinline)) void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+#endif // BTAG_COUNT_ALLOCS
+
+#endif // ALLOCATIONCOUNTER_H
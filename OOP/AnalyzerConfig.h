@@ -0,0 +1,96 @@
+#ifndef ANALYZERCONFIG_H
+#define ANALYZERCONFIG_H
+
+#include <Rtypes.h>
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+// Configuracion del analisis. Los observables se seleccionan por el nombre base de su
+// histograma (p. ej. "hJetPT", "hR50_vs_R95"); los que no se seleccionan no se reservan
+// ni se calculan sus variables.
+struct AnalyzerConfig {
+    // Jets principales por evento, como maximo kMaxLeadingJets (<= 0: kMaxLeadingJets)
+    static constexpr int kMaxLeadingJets = 8;
+    int leadingJets = 4;
+
+    // Entradas del TChain a procesar: [firstEntry, lastEntry) (lastEntry < 0: hasta el final)
+    Long64_t firstEntry = 0;
+    Long64_t lastEntry = -1;
+
+    // Preseleccion de eventos con las ramas de jets, antes de leer las de trazas: pasan los
+    // eventos con al menos minJets jets (1 como minimo) con pT en [jetPtMin, jetPtMax) y
+    // |eta| < jetEtaMax. Por defecto, todos los eventos con algun jet
+    struct Preselection {
+        int minJets = 1;
+        double jetPtMin = 0;
+        double jetPtMax = 0;  // <= 0: sin limite
+        double jetEtaMax = 0; // <= 0: sin limite
+
+        bool AcceptsJet(Float_t pt, Float_t eta) const {
+            return pt >= jetPtMin && (jetPtMax <= 0 || pt < jetPtMax) && (jetEtaMax <= 0 || std::fabs(eta) < jetEtaMax);
+        }
+
+        // Descripcion para las firmas de las salidas (vacia con la preseleccion por defecto)
+        std::string Describe() const {
+            if (minJets <= 1 && jetPtMin <= 0 && jetPtMax <= 0 && jetEtaMax <= 0) return "";
+            return "preselection=" + std::to_string(std::max(minJets, 1)) + "," + std::to_string(jetPtMin) + "," +
+                   std::to_string(jetPtMax) + "," + std::to_string(jetEtaMax);
+        }
+    } preselection;
+
+    // Directorio de los indices de entradas preseleccionadas por archivo (vacio: sin indice).
+    // En los archivos con indice solo se leen las entradas que pasan la preseleccion
+    std::string selectionCacheDir;
+
+    // Lotes de EventBatch::kEvents eventos en la cola de lectura anticipada de cada hilo
+    // (0: el mismo hilo lee y analiza). Con lectura anticipada cada hilo tiene un lector
+    int readAhead = 0;
+
+    // Analizar por lotes de EventBatch::kEvents eventos: cada calculo recorre el lote entero
+    // y los histogramas se llenan una vez por lote con FillN (mismo resultado)
+    bool eventBlocks = false;
+
+    // TTreeCache de cada TChain en MB (0: el de ROOT por defecto, que aprende las ramas en
+    // las primeras entradas). Con un tamano, las ramas activas se cachean desde el principio
+    // y se precargan los clusters siguientes
+    int treeCacheMB = 0;
+
+    // Estadisticas de E/S al terminar: lecturas por archivo y TTreePerfStats
+    bool ioStats = false;
+
+    // Informe JSON de tiempos por fase, ritmo y latencia por evento (vacio: no se mide)
+    std::string timingReport;
+
+    // Prefijo de los .npy con las variables de cada jet principal, <featureFile>.<columna>.npy
+    // (vacio: no se exportan)
+    std::string featureFile;
+    bool appendFeatures = false; // Agregar las filas a las que ya tiene featureFile (modo incremental)
+
+    // Puntos de control de LoopEvents (directorio vacio: desactivados), cada
+    // checkpointEvents eventos o checkpointSeconds segundos de cada hilo (0: sin limite)
+    std::string checkpointDir;
+    Long64_t checkpointEvents = 0;
+    double checkpointSeconds = 0;
+    bool resume = false; // Continuar desde los puntos de control de checkpointDir
+
+    // Histogramas por sabor: los observables por jet (y del perfil radial) tienen ademas una
+    // copia para cada categoria (b, c y ligeros) que solo llenan los jets de esa categoria
+    bool flavorSplit = false;
+
+    // Observables a llenar (vacio: todos los del registro)
+    std::vector<std::string> observables;
+
+    // Observables desactivados (tienen prioridad sobre la lista anterior)
+    std::vector<std::string> disabledObservables;
+
+    bool IsEnabled(const std::string& name) const {
+        if (std::find(disabledObservables.begin(), disabledObservables.end(), name) != disabledObservables.end()) {
+            return false;
+        }
+        return observables.empty() || std::find(observables.begin(), observables.end(), name) != observables.end();
+    }
+};
+
+#endif // ANALYZERCONFIG_H
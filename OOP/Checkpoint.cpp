@@ -0,0 +1,164 @@
+#include "Checkpoint.h"
+#include "FileSystem.h"
+#include <TFile.h>
+#include <glob.h>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+Checkpoint::Checkpoint(const AnalyzerConfig& config, Long64_t first, Long64_t last, const std::string& signature)
+    : fDir(config.checkpointDir), fFirst(first), fLast(last), fSignature(signature),
+      fEveryEvents(config.checkpointEvents), fEverySeconds(config.checkpointSeconds), fGeneration(0),
+      fSinceSave(0), fLastSave(std::chrono::steady_clock::now()) {}
+
+std::string Checkpoint::Path(const std::string& suffix) const {
+    return fDir + "/range_" + std::to_string(fFirst) + suffix;
+}
+
+std::string Checkpoint::GenerationPath(Long64_t generation, const char* extension) const {
+    return Path("." + std::to_string(generation) + extension);
+}
+
+bool Checkpoint::Save(const State& state, const HistogramSet& histograms, JetColumns* columns) {
+    fSinceSave = 0;
+    fLastSave = std::chrono::steady_clock::now();
+    Long64_t generation = fGeneration + 1;
+
+    // Histogramas de la nueva generacion. Los archivos de la generacion y el estado se
+    // llevan a disco antes del rename, y el directorio antes y despues: tras una caida del
+    // sistema el estado nunca apunta a una generacion incompleta
+    {
+        TFile file(GenerationPath(generation, ".root").c_str(), "RECREATE");
+        if (file.IsZombie()) {
+            std::cerr << "Error: no se pudo escribir el punto de control en " << fDir << std::endl;
+            return false;
+        }
+        bool written = histograms.Write();
+        file.Close();
+        if (!written || file.TestBit(TFile::kWriteError)) {
+            std::cerr << "Error: no se pudo escribir el punto de control en " << fDir << std::endl;
+            return false;
+        }
+    }
+    if (!SyncPath(GenerationPath(generation, ".root"))) {
+        std::cerr << "Error: no se pudo escribir el punto de control en " << fDir << std::endl;
+        return false;
+    }
+
+    // Bloque parcial de las columnas exportadas
+    if (columns) {
+        FILE* block = std::fopen(GenerationPath(generation, ".block").c_str(), "wb");
+        bool saved = block && columns->Save(block);
+        if (block) saved = (std::fflush(block) == 0) && (fsync(fileno(block)) == 0) && saved;
+        if (block) saved = (std::fclose(block) == 0) && saved;
+        if (!saved) {
+            std::cerr << "Error: no se pudo escribir el punto de control en " << fDir << std::endl;
+            return false;
+        }
+    }
+
+    // Estado: se escribe aparte y reemplaza al anterior con rename
+    std::string statePath = Path(".state");
+    {
+        std::ofstream out(statePath + ".tmp");
+        out << "first " << fFirst << "\n"
+            << "last " << fLast << "\n"
+            << "signature " << fSignature << "\n"
+            << "generation " << generation << "\n"
+            << "next " << state.next << "\n"
+            << "bytesRead " << state.bytesRead << "\n"
+            << "eventsRead " << state.eventsRead << "\n"
+            << "eventsSelected " << state.eventsSelected << "\n"
+            << "columnRows " << state.columnRows << "\n";
+        out.close();
+        if (!out || !SyncPath(statePath + ".tmp") || !SyncPath(fDir)) {
+            std::cerr << "Error: no se pudo escribir " << statePath << ".tmp" << std::endl;
+            return false;
+        }
+    }
+    if (std::rename((statePath + ".tmp").c_str(), statePath.c_str()) != 0 || !SyncPath(fDir)) {
+        std::cerr << "Error: no se pudo reemplazar " << statePath << std::endl;
+        return false;
+    }
+
+    // La generacion anterior ya no se usa
+    std::remove(GenerationPath(fGeneration, ".root").c_str());
+    std::remove(GenerationPath(fGeneration, ".block").c_str());
+    fGeneration = generation;
+    return true;
+}
+
+bool Checkpoint::Load(State& state, HistogramSet& histograms, JetColumns* columns) {
+    std::ifstream in(Path(".state"));
+    if (!in) {
+        std::cout << "Rango [" << fFirst << ", " << fLast << "): sin punto de control, se empieza desde el principio" << std::endl;
+        return false;
+    }
+
+    Long64_t first = -1, last = -1, generation = 0;
+    std::string signature, key;
+    State loaded;
+    while (in >> key) {
+        if (key == "first") in >> first;
+        else if (key == "last") in >> last;
+        else if (key == "signature") in >> signature;
+        else if (key == "generation") in >> generation;
+        else if (key == "next") in >> loaded.next;
+        else if (key == "bytesRead") in >> loaded.bytesRead;
+        else if (key == "eventsRead") in >> loaded.eventsRead;
+        else if (key == "eventsSelected") in >> loaded.eventsSelected;
+        else if (key == "columnRows") in >> loaded.columnRows;
+    }
+    if (first != fFirst || last != fLast || signature != fSignature || loaded.next < fFirst || loaded.next > fLast) {
+        std::cerr << "Aviso: el punto de control de " << Path(".state") << " es de otro rango o configuracion;"
+                  << " se empieza desde el principio" << std::endl;
+        return false;
+    }
+
+    // Primero las columnas (si fallan, los histogramas no cambian)
+    if (columns) {
+        FILE* block = std::fopen(GenerationPath(generation, ".block").c_str(), "rb");
+        bool restored = block && columns->Restore(loaded.columnRows, block);
+        if (block) std::fclose(block);
+        if (!restored) {
+            std::cerr << "Aviso: faltan las columnas exportadas del punto de control de " << Path(".state")
+                      << "; se empieza desde el principio" << std::endl;
+            return false;
+        }
+    }
+
+    TFile file(GenerationPath(generation, ".root").c_str(), "READ");
+    if (file.IsZombie() || !histograms.Read(file)) {
+        std::cerr << "Aviso: faltan histogramas en el punto de control de " << Path(".state")
+                  << "; se empieza desde el principio" << std::endl;
+        return false;
+    }
+
+    std::cout << "Rango [" << fFirst << ", " << fLast << "): se reanuda en la entrada " << loaded.next << std::endl;
+    state = loaded;
+    fGeneration = generation;
+    return true;
+}
+
+void Checkpoint::RemoveAll(const std::string& dir) {
+    glob_t matches;
+    if (glob((dir + "/range_*").c_str(), 0, nullptr, &matches) == 0) {
+        for (size_t k = 0; k < matches.gl_pathc; k++) {
+            std::remove(matches.gl_pathv[k]);
+        }
+    }
+    globfree(&matches);
+    std::remove(dir.c_str());
+}
+
+std::string Checkpoint::Signature(const std::vector<std::string>& parts) {
+    ULong64_t hash = 14695981039185344037ull;
+    for (const auto& part : parts) {
+        for (unsigned char ch : part + '\n') {
+            hash = (hash ^ ch) * 1099511628211ull;
+        }
+    }
+    char hex[17];
+    std::snprintf(hex, sizeof(hex), "%016llx", (unsigned long long)hash);
+    return hex;
+}
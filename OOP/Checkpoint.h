@@ -0,0 +1,82 @@
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include <Rtypes.h>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "AnalyzerConfig.h"
+#include "HistogramRegistry.h"
+#include "JetColumns.h"
+
+// Puntos de control de un rango de entradas [first, last) del TChain (un hilo de
+// LoopEvents). Cada punto de control guarda los histogramas del rango, la siguiente
+// entrada a procesar y el bloque parcial de las columnas exportadas en archivos nuevos
+// (generacion g), los lleva a disco y despues reemplaza el estado con un rename, que es
+// atomico: una interrupcion, o una caida del sistema, deja siempre el punto de control
+// anterior o el nuevo, completo.
+//
+//   dir/range_<first>.state      estado: rango, firma de la configuracion, generacion, progreso
+//   dir/range_<first>.<g>.root   histogramas
+//   dir/range_<first>.<g>.block  filas del bloque parcial de JetColumns
+//
+// Al reanudar, cada rango continua desde su ultimo estado si el rango y la firma (archivos
+// de entrada, jets principales, observables, exportacion) coinciden; por eso hay que
+// reanudar con el mismo numero de hilos y el mismo rango de entradas.
+class Checkpoint {
+public:
+    // Progreso del rango al guardar el punto de control
+    struct State {
+        Long64_t next = 0;       // Siguiente entrada a procesar
+        Long64_t bytesRead = 0;
+        Long64_t eventsRead = 0;
+        Long64_t eventsSelected = 0;
+        Long64_t columnRows = 0; // Filas exportadas hasta aqui
+    };
+
+    Checkpoint(const AnalyzerConfig& config, Long64_t first, Long64_t last, const std::string& signature);
+
+    // Activado (config.checkpointDir no vacio)
+    bool Enabled() const { return !fDir.empty(); }
+
+    // Cuenta un evento procesado; true si toca guardar (cada N eventos o T segundos)
+    bool Due() {
+        if (!Enabled()) return false;
+        fSinceSave++;
+        if (fEveryEvents > 0 && fSinceSave >= fEveryEvents) return true;
+        // El reloj se consulta cada 64 eventos
+        if (fEverySeconds > 0 && (fSinceSave & 63) == 0) {
+            std::chrono::duration<Double_t> elapsed = std::chrono::steady_clock::now() - fLastSave;
+            return elapsed.count() >= fEverySeconds;
+        }
+        return false;
+    }
+
+    bool Save(const State& state, const HistogramSet& histograms, JetColumns* columns);
+
+    // Carga el ultimo estado guardado del rango y suma sus histogramas a histograms;
+    // false (sin cambiar histograms) si no hay uno valido
+    bool Load(State& state, HistogramSet& histograms, JetColumns* columns);
+
+    // Borra los puntos de control de dir (al terminar el analisis)
+    static void RemoveAll(const std::string& dir);
+
+    // Firma (FNV-1a, en hexadecimal) de los parametros que determinan el resultado
+    static std::string Signature(const std::vector<std::string>& parts);
+
+private:
+    std::string Path(const std::string& suffix) const;
+    std::string GenerationPath(Long64_t generation, const char* extension) const;
+
+    std::string fDir;
+    Long64_t fFirst;
+    Long64_t fLast;
+    std::string fSignature;
+    Long64_t fEveryEvents;
+    Double_t fEverySeconds;
+    Long64_t fGeneration; // Generacion del ultimo punto de control guardado o cargado
+    Long64_t fSinceSave;  // Eventos desde el ultimo punto de control
+    std::chrono::steady_clock::time_point fLastSave;
+};
+
+#endif // CHECKPOINT_H
@@ -0,0 +1,114 @@
+#include "DelphesReader.h"
+#include <algorithm>
+
+DelphesReader::DelphesReader(TChain* chain, bool labels)
+    : fChain(chain), Jet_size(0), Track_size(0), fLabels(labels), fCurrent(-1), fMaxJets(0), fMaxTracks(0), fNJetBranches(0) {
+    fBranches = {"Jet_size", "Jet.PT", "Jet.Eta", "Jet.Phi", "Jet.Mass", "Jet.NCharged", "Jet.NNeutrals",
+                 "Track_size", "Track.PT", "Track.Eta", "Track.Phi", "Track.Charge", "Track.D0", "Track.DZ"};
+    if (labels) {
+        fBranches.push_back("Jet.Flavor");
+        fBranches.push_back("Jet.BTag");
+    }
+
+    // Desactivar todas las ramas (Particle, Tower, EFlow*, FatJet, ...) y activar las necesarias
+    fChain->SetMakeClass(1);
+    fChain->SetBranchStatus("*", 0);
+    for (const char* branch : fBranches) {
+        fChain->SetBranchStatus(branch, 1);
+    }
+
+    // Arrays de un elemento hasta conocer los maximos del primer archivo
+    Resize(1, 1);
+}
+
+Long64_t DelphesReader::LoadTree(Long64_t entry) {
+    Long64_t centry = fChain->LoadTree(entry);
+    if (centry < 0 || fChain->GetTreeNumber() == fCurrent) return centry;
+
+    // Otro archivo: los arrays deben caber su maximo de jets y de trazas por evento
+    fCurrent = fChain->GetTreeNumber();
+    TTree* tree = fChain->GetTree();
+    Int_t maxJets = CountMaximum(tree, "Jet.PT");
+    Int_t maxTracks = CountMaximum(tree, "Track.PT");
+    if (maxJets > fMaxJets || maxTracks > fMaxTracks) Resize(maxJets, maxTracks);
+    return centry;
+}
+
+Int_t DelphesReader::CountMaximum(TTree* tree, const char* branch) {
+    TLeaf* leaf = tree->GetLeaf(branch);
+    TLeaf* count = leaf ? leaf->GetLeafCount() : nullptr;
+    return count ? count->GetMaximum() : 0;
+}
+
+void DelphesReader::Resize(Int_t maxJets, Int_t maxTracks) {
+    fMaxJets = std::max(maxJets, fMaxJets);
+    fMaxTracks = std::max(maxTracks, fMaxTracks);
+
+    for (auto* column : {&fJetPT, &fJetEta, &fJetPhi, &fJetMass}) column->resize(fMaxJets);
+    for (auto* column : {&fJetNCharged, &fJetNNeutrals}) column->resize(fMaxJets);
+    for (auto* column : {&fJetFlavor, &fJetBTag}) column->resize(fMaxJets);
+    for (auto* column : {&fTrackPT, &fTrackEta, &fTrackPhi, &fTrackD0, &fTrackDZ}) column->resize(fMaxTracks);
+    fTrackCharge.resize(fMaxTracks);
+
+    Jet_PT = fJetPT.data();
+    Jet_Eta = fJetEta.data();
+    Jet_Phi = fJetPhi.data();
+    Jet_Mass = fJetMass.data();
+    Jet_NCharged = fJetNCharged.data();
+    Jet_NNeutrals = fJetNNeutrals.data();
+    Jet_Flavor = fJetFlavor.data();
+    Jet_BTag = fJetBTag.data();
+    Track_PT = fTrackPT.data();
+    Track_Eta = fTrackEta.data();
+    Track_Phi = fTrackPhi.data();
+    Track_Charge = fTrackCharge.data();
+    Track_D0 = fTrackD0.data();
+    Track_DZ = fTrackDZ.data();
+
+    // Los arrays pueden haberse movido
+    Bind();
+}
+
+void DelphesReader::Bind() {
+    fChain->SetBranchAddress("Jet_size", &Jet_size, &fJetBranches[0]);
+    fChain->SetBranchAddress("Jet.PT", Jet_PT, &fJetBranches[1]);
+    fChain->SetBranchAddress("Jet.Eta", Jet_Eta, &fJetBranches[2]);
+    fChain->SetBranchAddress("Jet.Phi", Jet_Phi, &fJetBranches[3]);
+    fChain->SetBranchAddress("Jet.Mass", Jet_Mass, &fJetBranches[4]);
+    fChain->SetBranchAddress("Jet.NCharged", Jet_NCharged, &fJetBranches[5]);
+    fChain->SetBranchAddress("Jet.NNeutrals", Jet_NNeutrals, &fJetBranches[6]);
+    fNJetBranches = 7;
+    if (fLabels) {
+        fChain->SetBranchAddress("Jet.Flavor", Jet_Flavor, &fJetBranches[7]);
+        fChain->SetBranchAddress("Jet.BTag", Jet_BTag, &fJetBranches[8]);
+        fNJetBranches = 9;
+    }
+    fChain->SetBranchAddress("Track_size", &Track_size, &fTrackBranches[0]);
+    fChain->SetBranchAddress("Track.PT", Track_PT, &fTrackBranches[1]);
+    fChain->SetBranchAddress("Track.Eta", Track_Eta, &fTrackBranches[2]);
+    fChain->SetBranchAddress("Track.Phi", Track_Phi, &fTrackBranches[3]);
+    fChain->SetBranchAddress("Track.Charge", Track_Charge, &fTrackBranches[4]);
+    fChain->SetBranchAddress("Track.D0", Track_D0, &fTrackBranches[5]);
+    fChain->SetBranchAddress("Track.DZ", Track_DZ, &fTrackBranches[6]);
+}
+
+Int_t DelphesReader::GetJets(Long64_t centry) {
+    Int_t nbytes = 0;
+    for (Int_t k = 0; k < fNJetBranches; k++) {
+        nbytes += fJetBranches[k]->GetEntry(centry);
+    }
+    Track_size = 0;
+    return nbytes;
+}
+
+Int_t DelphesReader::GetTracks(Long64_t centry) {
+    Int_t nbytes = 0;
+    for (TBranch* branch : fTrackBranches) {
+        nbytes += branch->GetEntry(centry);
+    }
+    return nbytes;
+}
+
+size_t DelphesReader::Bytes() const {
+    return fMaxJets * (6 * sizeof(Float_t) + 2 * sizeof(UInt_t)) + fMaxTracks * (5 * sizeof(Float_t) + sizeof(Int_t));
+}
@@ -0,0 +1,95 @@
+#ifndef DELPHESREADER_H
+#define DELPHESREADER_H
+
+#include <TChain.h>
+#include <TLeaf.h>
+#include <vector>
+
+// Lector de las ramas Jet y Track del arbol Delphes que usa el analisis, en lugar de la
+// clase generada por MakeClass (MyClass), que reservaba arrays de tamano fijo para todas
+// las ramas del arbol con los maximos de un solo archivo: cientos de KB por hilo, y un
+// evento con mas trazas que kMaxTrack escribia fuera de sus arrays.
+//
+// Solo se activan y enlazan las ramas que se usan, y se leen en dos etapas: primero las
+// de jets y, solo para los eventos que pasan la preseleccion, las de trazas, que son
+// la mayor parte de los bytes del evento. Los arrays se dimensionan con el
+// maximo de elementos por evento de cada archivo, que guarda la hoja de conteo de la rama
+// (lo mismo que MakeClass, pero en cada archivo): al pasar a un archivo con mas jets o
+// trazas por evento, los arrays crecen y se vuelven a enlazar.
+class DelphesReader {
+public:
+    // labels: leer tambien Jet.Flavor y Jet.BTag
+    DelphesReader(TChain* chain, bool labels);
+
+    DelphesReader(const DelphesReader&) = delete;
+    DelphesReader& operator=(const DelphesReader&) = delete;
+
+    // Como en MakeClass: carga el arbol de la entrada y, si es otro archivo, ajusta los arrays
+    Long64_t LoadTree(Long64_t entry);
+
+    // Lectura por etapas de la entrada local centry (la que devuelve LoadTree): Jet_size y
+    // las ramas Jet.* (Track_size queda a 0), y despues Track_size y Track.*. Devuelven los
+    // bytes leidos
+    Int_t GetJets(Long64_t centry);
+    Int_t GetTracks(Long64_t centry);
+
+    // Ramas activas (Jet_size, Jet.PT, ...)
+    const std::vector<const char*>& Branches() const { return fBranches; }
+
+    // Capacidad de los arrays: maximo de jets y de trazas por evento de los archivos leidos
+    Int_t MaxJets() const { return fMaxJets; }
+    Int_t MaxTracks() const { return fMaxTracks; }
+
+    // Memoria de los arrays (bytes)
+    size_t Bytes() const;
+
+    TChain* fChain;
+
+    // Evento cargado: mismos nombres que en MyClass
+    Int_t Jet_size;
+    Float_t* Jet_PT;
+    Float_t* Jet_Eta;
+    Float_t* Jet_Phi;
+    Float_t* Jet_Mass;
+    Int_t* Jet_NCharged;
+    Int_t* Jet_NNeutrals;
+    UInt_t* Jet_Flavor; // Solo con labels (si no, ceros)
+    UInt_t* Jet_BTag;
+
+    Int_t Track_size;
+    Float_t* Track_PT;
+    Float_t* Track_Eta;
+    Float_t* Track_Phi;
+    Int_t* Track_Charge;
+    Float_t* Track_D0;
+    Float_t* Track_DZ;
+
+private:
+    // Maximo de elementos por evento de la rama branch en el arbol actual
+    static Int_t CountMaximum(TTree* tree, const char* branch);
+
+    void Resize(Int_t maxJets, Int_t maxTracks);
+    void Bind();
+
+    static constexpr Int_t kJetBranches = 9;   // Jet_size, Jet.* (con Flavor y BTag)
+    static constexpr Int_t kTrackBranches = 7; // Track_size, Track.*
+
+    bool fLabels;
+    Int_t fCurrent; // Arbol del TChain cargado (-1: ninguno)
+    Int_t fMaxJets;
+    Int_t fMaxTracks;
+    std::vector<const char*> fBranches;
+
+    // Ramas enlazadas de cada etapa; el TChain las actualiza al cambiar de archivo
+    TBranch* fJetBranches[kJetBranches];
+    TBranch* fTrackBranches[kTrackBranches];
+    Int_t fNJetBranches;
+
+    std::vector<Float_t> fJetPT, fJetEta, fJetPhi, fJetMass;
+    std::vector<Int_t> fJetNCharged, fJetNNeutrals;
+    std::vector<UInt_t> fJetFlavor, fJetBTag;
+    std::vector<Float_t> fTrackPT, fTrackEta, fTrackPhi, fTrackD0, fTrackDZ;
+    std::vector<Int_t> fTrackCharge;
+};
+
+#endif // DELPHESREADER_H
@@ -0,0 +1,235 @@
+#include "DiscriminationRanking.h"
+#include "FileSystem.h"
+#include "HistogramMerger.h"
+#include "JetFeatures.h"
+#include <TH2.h>
+#include <TROOT.h>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <thread>
+
+std::vector<DiscriminationRanking::Metrics> DiscriminationRanking::Rank(
+    const std::vector<std::pair<const TH1*, const TH1*>>& pairs, Int_t nThreads) {
+    // Cada hilo toma el siguiente histograma libre: el coste depende de sus celdas
+    std::vector<Metrics> ranking(pairs.size());
+    std::atomic<size_t> next(0);
+    std::vector<std::thread> threads;
+    nThreads = std::max(1, std::min<Int_t>(nThreads, pairs.size()));
+    for (Int_t k = 0; k < nThreads; k++) {
+        threads.emplace_back([&]() {
+            for (size_t p = next++; p < pairs.size(); p = next++) {
+                ranking[p] = Compute(*pairs[p].first, *pairs[p].second);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    std::stable_sort(ranking.begin(), ranking.end(), [](const Metrics& a, const Metrics& b) {
+        if (a.dimension != b.dimension) return a.dimension < b.dimension;
+        return (a.separation != b.separation) ? a.separation > b.separation : a.auc > b.auc;
+    });
+    return ranking;
+}
+
+DiscriminationRanking::Metrics DiscriminationRanking::Compute(const TH1& signal, const TH1& background) {
+    Metrics m;
+    m.name = signal.GetName();
+    m.dimension = dynamic_cast<const TH2*>(&signal) ? 2 : 1;
+    m.signalEntries = signal.GetEntries();
+    m.backgroundEntries = background.GetEntries();
+    m.cut = "-";
+
+    // Contenido de todas las celdas, desbordamientos incluidos, normalizado a area unidad
+    Int_t nCells = signal.GetNcells();
+    Double_t sumSignal = 0, sumBackground = 0;
+    for (Int_t bin = 0; bin < nCells; bin++) {
+        sumSignal += signal.GetBinContent(bin);
+        sumBackground += background.GetBinContent(bin);
+    }
+    if (sumSignal <= 0 || sumBackground <= 0) return m;
+
+    std::vector<Cell> cells;
+    cells.reserve(nCells);
+    for (Int_t bin = 0; bin < nCells; bin++) {
+        Double_t s = signal.GetBinContent(bin) / sumSignal;
+        Double_t b = background.GetBinContent(bin) / sumBackground;
+        if (s + b > 0) m.separation += 0.5 * (s - b) * (s - b) / (s + b);
+        cells.push_back({s, b});
+    }
+
+    if (m.dimension == 1) {
+        // En el orden del eje pasan primero los valores bajos (x < c); si separa peor que
+        // el azar, el corte bueno es el contrario
+        Scan(cells, m.distance, m.auc);
+        m.cut = (m.auc >= 0.5) ? "<" : ">";
+        m.auc = std::max(m.auc, 1 - m.auc);
+        return m;
+    }
+
+    // 2D: celdas de mayor a menor fraccion de senal; las de igual fraccion forman un grupo
+    cells.erase(std::remove_if(cells.begin(), cells.end(), [](const Cell& c) { return c.first + c.second <= 0; }),
+                cells.end());
+    auto purity = [](const Cell& c) { return c.first / (c.first + c.second); };
+    std::sort(cells.begin(), cells.end(), [&](const Cell& a, const Cell& b) { return purity(a) > purity(b); });
+    std::vector<Cell> groups;
+    for (const Cell& cell : cells) {
+        if (!groups.empty() && purity(groups.back()) == purity(cell)) {
+            groups.back().first += cell.first;
+            groups.back().second += cell.second;
+        } else {
+            groups.push_back(cell);
+        }
+    }
+    Scan(groups, m.distance, m.auc);
+    m.cut = "s/(s+b)";
+    return m;
+}
+
+void DiscriminationRanking::Scan(const std::vector<Cell>& cells, Double_t& distance, Double_t& auc) {
+    // AUC: probabilidad de que un jet de senal pase el corte antes que uno de fondo (la
+    // mitad si estan en la misma celda)
+    Double_t passedSignal = 0, passedBackground = 0;
+    distance = 0;
+    auc = 0;
+    for (const Cell& cell : cells) {
+        Double_t laterBackground = 1 - passedBackground - cell.second;
+        auc += cell.first * (std::max(laterBackground, 0.0) + 0.5 * cell.second);
+        passedSignal += cell.first;
+        passedBackground += cell.second;
+        distance = std::max(distance, std::fabs(passedSignal - passedBackground));
+    }
+}
+
+bool DiscriminationRanking::Write(const std::vector<Metrics>& ranking, const std::string& path) {
+    // Una tabla por dimension, cada una con su propia numeracion y sus metricas
+    const char* headers[] = {
+        "# Histogramas 1D: distancia de Kolmogorov-Smirnov y AUC de un corte en la variable\n"
+        "# rango histograma corte separacion ks auc entradas_senal entradas_fondo\n",
+        "# Histogramas 2D: distancia de variacion total y AUC del mejor orden de las celdas (s/(s+b))\n"
+        "# rango histograma corte separacion variacion_total auc_optima entradas_senal entradas_fondo\n"};
+    std::ofstream out(path);
+    for (Int_t dimension = 1; dimension <= 2; dimension++) {
+        if (dimension == 2) out << "\n";
+        out << headers[dimension - 1];
+        Int_t rank = 0;
+        for (const Metrics& m : ranking) {
+            if (m.dimension != dimension) continue;
+            out << ++rank << " " << m.name << " " << m.cut << " " << std::fixed << std::setprecision(6) << m.separation
+                << " " << m.distance << " " << m.auc << " " << std::setprecision(0) << m.signalEntries << " "
+                << m.backgroundEntries << "\n";
+        }
+    }
+    if (!out.flush()) {
+        std::cerr << "Error: no se pudo escribir " << path << std::endl;
+        return false;
+    }
+
+    // Resumen: los diez primeros de cada tabla
+    const char* distances[] = {"KS", "variacion total"};
+    const char* aucs[] = {"AUC", "AUC optima"};
+    std::cout << "Histogramas por poder de separacion (" << ranking.size() << ", tablas en " << path << "):" << std::endl;
+    std::cout << std::fixed << std::setprecision(4);
+    for (Int_t dimension = 1; dimension <= 2; dimension++) {
+        Int_t rank = 0;
+        for (const Metrics& m : ranking) {
+            if (m.dimension != dimension || rank >= 10) continue;
+            if (rank == 0) std::cout << "  " << dimension << "D:" << std::endl;
+            std::cout << std::setw(4) << ++rank << "  " << std::left << std::setw(24) << m.name << std::right
+                      << "  separacion " << m.separation << "  " << distances[dimension - 1] << " " << m.distance
+                      << "  " << aucs[dimension - 1] << " " << m.auc << " (" << m.cut << ")" << std::endl;
+        }
+    }
+    std::cout << std::defaultfloat << std::setprecision(6);
+    return true;
+}
+
+bool DiscriminationRanking::Run(const std::string& signalPath, const std::string& backgroundPath,
+                                const std::string& output, Int_t nThreads) {
+    TH1::AddDirectory(kFALSE);
+    ROOT::EnableThreadSafety();
+    HistogramMerger::HistogramList signal, background;
+    if (!HistogramMerger::Read(signalPath, signal) || !HistogramMerger::Read(backgroundPath, background)) {
+        HistogramMerger::Delete(signal);
+        HistogramMerger::Delete(background);
+        return false;
+    }
+
+    // Parejas por nombre, en el orden de la senal; se omiten las que no tienen el mismo binning
+    std::map<std::string, const TH1*> byName;
+    for (const TH1* h : background) {
+        byName[h->GetName()] = h;
+    }
+    std::vector<std::pair<const TH1*, const TH1*>> pairs;
+    for (const TH1* h : signal) {
+        auto match = byName.find(h->GetName());
+        if (match != byName.end() && match->second->GetNcells() == h->GetNcells()) {
+            pairs.push_back({h, match->second});
+        }
+    }
+    if (pairs.size() < signal.size()) {
+        std::cout << "Histogramas sin pareja en " << backgroundPath << ": " << signal.size() - pairs.size() << std::endl;
+    }
+
+    bool written = false;
+    if (pairs.empty()) {
+        std::cerr << "Error: " << signalPath << " y " << backgroundPath << " no tienen histogramas comunes" << std::endl;
+    } else {
+        written = RankTo(pairs, output, nThreads);
+    }
+    HistogramMerger::Delete(signal);
+    HistogramMerger::Delete(background);
+    return written;
+}
+
+bool DiscriminationRanking::RunFlavors(const std::string& input, const std::string& output, Int_t nThreads) {
+    TH1::AddDirectory(kFALSE);
+    ROOT::EnableThreadSafety();
+    HistogramMerger::HistogramList histograms;
+    if (!HistogramMerger::Read(input, histograms)) return false;
+
+    // Cada rebanada de jets b con la de jets ligeros de la misma copia
+    std::string signalSuffix = std::string("_") + FlavorCategoryName(kFlavorB);
+    std::string backgroundSuffix = std::string("_") + FlavorCategoryName(kFlavorLight);
+    std::map<std::string, const TH1*> byName;
+    for (const TH1* h : histograms) {
+        byName[h->GetName()] = h;
+    }
+    std::vector<std::pair<const TH1*, const TH1*>> pairs;
+    for (const TH1* h : histograms) {
+        std::string name = h->GetName();
+        if (name.size() <= signalSuffix.size() ||
+            name.compare(name.size() - signalSuffix.size(), signalSuffix.size(), signalSuffix) != 0) {
+            continue;
+        }
+        auto match = byName.find(name.substr(0, name.size() - signalSuffix.size()) + backgroundSuffix);
+        if (match != byName.end() && match->second->GetNcells() == h->GetNcells()) {
+            pairs.push_back({h, match->second});
+        }
+    }
+
+    bool written = false;
+    if (pairs.empty()) {
+        std::cerr << "Error: " << input << " no tiene histogramas por sabor (--flavor-split)" << std::endl;
+    } else {
+        written = RankTo(pairs, output, nThreads, signalSuffix);
+    }
+    HistogramMerger::Delete(histograms);
+    return written;
+}
+
+bool DiscriminationRanking::RankTo(const std::vector<std::pair<const TH1*, const TH1*>>& pairs,
+                                   const std::string& output, Int_t nThreads, const std::string& suffix) {
+    if (!MakeParentDirectory(output)) return false;
+    std::vector<Metrics> ranking = Rank(pairs, nThreads);
+    for (Metrics& m : ranking) {
+        if (!suffix.empty() && m.name.size() > suffix.size()) m.name.resize(m.name.size() - suffix.size());
+    }
+    return Write(ranking, output);
+}
@@ -0,0 +1,65 @@
+#ifndef DISCRIMINATIONRANKING_H
+#define DISCRIMINATIONRANKING_H
+
+#include <TH1.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Clasificacion de los histogramas por su poder para separar senal (jets b) de fondo
+// (jets ligeros). Para cada histograma con su pareja de senal y fondo, normalizados a
+// area unidad, se calculan:
+//   - poder de separacion: <S^2> = 1/2 sum (s - b)^2 / (s + b) sobre las celdas (0 a 1)
+//   - distancia: max |S(c) - B(c)| entre las acumuladas en el orden del corte
+//   - area bajo la curva ROC del corte (0.5 a 1)
+// En 1D el corte es x > c o x < c, el que separa mejor, con los desbordamientos en los
+// extremos: la distancia es la de Kolmogorov-Smirnov. En 2D no hay un orden natural y se
+// ordenan las celdas por su fraccion de senal s / (s + b), el mejor corte posible con ese
+// binning: la distancia es la de variacion total, 1/2 sum |s - b|, y el AUC es el del
+// mejor orden (ambos optimistas con pocas entradas por celda). Por eso los histogramas
+// 1D y 2D se clasifican por separado. Las metricas de cada histograma son independientes
+// y se calculan en paralelo.
+class DiscriminationRanking {
+public:
+    struct Metrics {
+        std::string name;
+        Int_t dimension = 1;
+        std::string cut;          // ">" o "<" en 1D, "s/(s+b)" en 2D
+        Double_t separation = 0;
+        Double_t distance = 0; // Kolmogorov-Smirnov en 1D, variacion total en 2D
+        Double_t auc = 0.5;
+        Double_t signalEntries = 0;
+        Double_t backgroundEntries = 0;
+    };
+
+    // Metricas de cada pareja (senal, fondo) con nThreads hilos: primero las 1D y despues
+    // las 2D, cada grupo de mayor a menor poder de separacion (a igual poder, mayor AUC)
+    static std::vector<Metrics> Rank(const std::vector<std::pair<const TH1*, const TH1*>>& pairs, Int_t nThreads);
+
+    // Metricas de una pareja; las de un histograma vacio son las de dos iguales
+    static Metrics Compute(const TH1& signal, const TH1& background);
+
+    // Tablas de la clasificacion (1D y 2D) en path y sus primeras filas por pantalla
+    static bool Write(const std::vector<Metrics>& ranking, const std::string& path);
+
+    // Modo --rank: histogramas de dos histograms.root con los mismos nombres
+    static bool Run(const std::string& signalPath, const std::string& backgroundPath, const std::string& output,
+                    Int_t nThreads);
+
+    // Modo --rank con un archivo: rebanadas de jets b frente a las de jets ligeros
+    // (HistogramSet::SliceName, con config.flavorSplit)
+    static bool RunFlavors(const std::string& input, const std::string& output, Int_t nThreads);
+
+private:
+    // Clasificacion de las parejas en output; suffix se quita de los nombres de la tabla
+    static bool RankTo(const std::vector<std::pair<const TH1*, const TH1*>>& pairs, const std::string& output,
+                       Int_t nThreads, const std::string& suffix = "");
+
+    // Grupo de celdas en el orden del corte: contenido normalizado de senal y de fondo
+    using Cell = std::pair<Double_t, Double_t>;
+
+    // Distancia y AUC de las celdas en el orden del corte (de las que pasan primero a las ultimas)
+    static void Scan(const std::vector<Cell>& cells, Double_t& distance, Double_t& auc);
+};
+
+#endif // DISCRIMINATIONRANKING_H
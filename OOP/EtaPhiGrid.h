@@ -0,0 +1,92 @@
+#ifndef ETAPHIGRID_H
+#define ETAPHIGRID_H
+
+#include <TMath.h>
+#include <algorithm>
+#include <cmath>
+#include "EventArena.h"
+
+// Rejilla eta-phi de las trazas de un evento. Se construye una vez por evento y
+// devuelve, para cada jet, las trazas de las celdas vecinas a su eje: un superconjunto
+// de las trazas dentro del cono, en orden creciente de indice. Los indices por traza
+// viven en el EventArena del evento. El analizador no la usa: frente al kernel denso de
+// TrackBuffer no compensa en ningun tamano medido (tests/bench_track_matching); solo la
+// usan el benchmark y tests/test_track_matching.
+class EtaPhiGrid {
+public:
+    // El ancho de celda (0.5) es mayor que el radio del cono (0.4), asi que basta con
+    // revisar las celdas vecinas
+    static constexpr Double_t kCellSize = 0.5;
+    static constexpr Double_t kEtaMax = 5.0;
+    static constexpr Int_t kNEta = 20;
+    static constexpr Int_t kNPhi = 12;
+
+    // Construye la rejilla a partir de los arrays Track_Eta/Phi
+    void Build(Int_t nTracks, const Float_t* eta, const Float_t* phi, EventArena& arena) {
+        cellOfTrack = arena.Allocate<Int_t>(nTracks);
+        std::fill(cellStart, cellStart + kNCells + 1, 0);
+
+        // Contar trazas por celda
+        for (Int_t j = 0; j < nTracks; j++) {
+            // Eta o Phi no finitos: DeltaR es NaN y la traza nunca esta en el cono
+            Int_t cell = -1;
+            if (std::isfinite(eta[j]) && std::isfinite(phi[j])) {
+                cell = Cell(EtaBin(eta[j]), PhiBin(phi[j]));
+            }
+            cellOfTrack[j] = cell;
+            if (cell >= 0) cellStart[cell + 1]++;
+        }
+
+        for (Int_t c = 0; c < kNCells; c++) {
+            cellStart[c + 1] += cellStart[c];
+        }
+
+        // Repartir los indices manteniendo el orden original dentro de cada celda
+        cellTracks = arena.Allocate<Int_t>(cellStart[kNCells]);
+        std::copy(cellStart, cellStart + kNCells, fill);
+        for (Int_t j = 0; j < nTracks; j++) {
+            if (cellOfTrack[j] >= 0) cellTracks[fill[cellOfTrack[j]]++] = j;
+        }
+    }
+
+    // Indices (ordenados) de las trazas candidatas para un jet en (eta, phi); candidates
+    // debe tener espacio para todas las trazas. Devuelve el numero de candidatas
+    Int_t Query(Double_t eta, Double_t phi, Int_t* candidates) const {
+        Int_t n = 0;
+        if (!std::isfinite(eta) || !std::isfinite(phi)) return n;
+
+        Int_t etaBin = EtaBin(eta);
+        Int_t phiBin = PhiBin(phi);
+        for (Int_t ie = std::max(etaBin - 1, 0); ie <= std::min(etaBin + 1, kNEta - 1); ie++) {
+            for (Int_t dp = -1; dp <= 1; dp++) {
+                Int_t cell = Cell(ie, (phiBin + dp + kNPhi) % kNPhi);
+                n = std::copy(cellTracks + cellStart[cell], cellTracks + cellStart[cell + 1], candidates + n) - candidates;
+            }
+        }
+        std::sort(candidates, candidates + n);
+        return n;
+    }
+
+private:
+    static Int_t EtaBin(Double_t eta) {
+        Double_t bin = std::floor((eta + kEtaMax) / kCellSize);
+        return (Int_t)std::min(std::max(bin, 0.0), (Double_t)(kNEta - 1));
+    }
+
+    static Int_t PhiBin(Double_t phi) {
+        Double_t x = (phi + TMath::Pi()) / TMath::TwoPi();
+        Int_t bin = (Int_t)std::floor((x - std::floor(x)) * kNPhi);
+        return std::min(std::max(bin, 0), kNPhi - 1);
+    }
+
+    static Int_t Cell(Int_t etaBin, Int_t phiBin) { return etaBin * kNPhi + phiBin; }
+
+    static constexpr Int_t kNCells = kNEta * kNPhi;
+
+    Int_t* cellOfTrack = nullptr;
+    Int_t* cellTracks = nullptr;
+    Int_t cellStart[kNCells + 1];
+    Int_t fill[kNCells];
+};
+
+#endif // ETAPHIGRID_H
@@ -0,0 +1,63 @@
+#ifndef EVENTARENA_H
+#define EVENTARENA_H
+
+#include <Rtypes.h>
+#include <cstdlib>
+#include <iostream>
+#include <type_traits>
+
+// Memoria de trabajo de un evento: un solo bloque por hilo, reservado para el peor caso
+// (el maximo de trazas por evento del archivo, N jets principales) y repartido por
+// desplazamiento. Reset() lo libera entero al empezar cada evento, asi que en regimen
+// estacionario no hay reservas de memoria. Solo para tipos triviales.
+class EventArena {
+public:
+    static constexpr size_t kAlign = 64; // Linea de cache
+
+    EventArena() : fData(nullptr), fCapacity(0), fUsed(0), fHighWater(0) {}
+    ~EventArena() { std::free(fData); }
+    EventArena(const EventArena&) = delete;
+    EventArena& operator=(const EventArena&) = delete;
+
+    // Reserva el bloque (una sola vez por hilo)
+    void Reserve(size_t bytes) {
+        if (bytes <= fCapacity) return;
+        std::free(fData);
+        fCapacity = (bytes + kAlign - 1) / kAlign * kAlign;
+        fData = static_cast<char*>(std::aligned_alloc(kAlign, fCapacity));
+        fUsed = 0;
+    }
+
+    // Espacio para n objetos de tipo T, alineado a kAlign; valido hasta el siguiente Reset()
+    template <class T>
+    T* Allocate(size_t n) {
+        static_assert(std::is_trivially_destructible<T>::value, "EventArena solo guarda tipos triviales");
+        size_t bytes = (n * sizeof(T) + kAlign - 1) / kAlign * kAlign;
+        if (fUsed + bytes > fCapacity) {
+            // El bloque cubre el peor caso del arbol: quedarse sin espacio es un error de dimensionado
+            std::cerr << "EventArena: se necesitan " << fUsed + bytes << " bytes y hay " << fCapacity << std::endl;
+            std::abort();
+        }
+        T* p = reinterpret_cast<T*>(fData + fUsed);
+        fUsed += bytes;
+        if (fUsed > fHighWater) fHighWater = fUsed;
+        return p;
+    }
+
+    void Reset() { fUsed = 0; }
+
+    // Bytes necesarios para n objetos de tipo T (para dimensionar el bloque)
+    template <class T>
+    static size_t Bytes(size_t n) { return (n * sizeof(T) + kAlign - 1) / kAlign * kAlign; }
+
+    size_t Capacity() const { return fCapacity; }
+    size_t HighWater() const { return fHighWater; }
+
+private:
+    char* fData;
+    size_t fCapacity;
+    size_t fUsed;
+    size_t fHighWater; // Maximo usado en un evento
+};
+
+#endif // EVENTARENA_H
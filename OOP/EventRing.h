@@ -0,0 +1,122 @@
+#ifndef EVENTRING_H
+#define EVENTRING_H
+
+#include <Rtypes.h>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+#include "EventView.h"
+
+// Estadisticas de la lectura anticipada: si el lector espera mucho, el calculo es el
+// cuello de botella; si espera el calculo, lo es la lectura (E/S y descompresion)
+struct PipelineStats {
+    Int_t depth = 0;                 // Lotes en la cola
+    Long64_t batches = 0;            // Lotes analizados
+    Double_t occupancy = 0;          // Suma de los lotes listos al pedir uno (media: occupancy / batches)
+    Long64_t readerStalls = 0;       // Veces que el lector encontro la cola llena
+    Double_t readerStallSeconds = 0;
+    Long64_t computeStalls = 0;      // Veces que el calculo encontro la cola vacia
+    Double_t computeStallSeconds = 0;
+
+    void Add(const PipelineStats& other) {
+        depth = std::max(depth, other.depth);
+        batches += other.batches;
+        occupancy += other.occupancy;
+        readerStalls += other.readerStalls;
+        readerStallSeconds += other.readerStallSeconds;
+        computeStalls += other.computeStalls;
+        computeStallSeconds += other.computeStallSeconds;
+    }
+};
+
+// Cola circular acotada de lotes de eventos entre un hilo lector y un hilo de calculo.
+// Los lotes se reservan al construir la cola y se reutilizan: el lector rellena uno
+// libre (BeginWrite/EndWrite) y el calculo consume los listos en orden (BeginRead/EndRead).
+class EventRing {
+public:
+    EventRing(Int_t depth, Int_t maxJets, Int_t maxTracks)
+        : fHead(0), fReady(0), fClosed(false) {
+        fSlots.reserve(depth);
+        for (Int_t k = 0; k < depth; k++) {
+            fSlots.emplace_back(maxJets, maxTracks);
+        }
+        fStats.depth = depth;
+    }
+
+    // Lector: lote libre, vacio (espera si la cola esta llena)
+    EventBatch* BeginWrite() {
+        std::unique_lock<std::mutex> lock(fMutex);
+        if (fReady == (Int_t)fSlots.size()) {
+            fStats.readerStalls++;
+            auto start = std::chrono::steady_clock::now();
+            fNotFull.wait(lock, [this]() { return fReady < (Int_t)fSlots.size(); });
+            fStats.readerStallSeconds += Seconds(start);
+        }
+        EventBatch* batch = &fSlots[(fHead + fReady) % fSlots.size()];
+        batch->Clear();
+        return batch;
+    }
+
+    // Lector: el lote de BeginWrite queda listo
+    void EndWrite() {
+        {
+            std::lock_guard<std::mutex> lock(fMutex);
+            fReady++;
+        }
+        fNotEmpty.notify_one();
+    }
+
+    // Lector: no habra mas lotes
+    void Close() {
+        {
+            std::lock_guard<std::mutex> lock(fMutex);
+            fClosed = true;
+        }
+        fNotEmpty.notify_one();
+    }
+
+    // Calculo: siguiente lote listo (espera si no hay); nullptr cuando el lector ha terminado
+    EventBatch* BeginRead() {
+        std::unique_lock<std::mutex> lock(fMutex);
+        if (fReady == 0 && !fClosed) {
+            fStats.computeStalls++;
+            auto start = std::chrono::steady_clock::now();
+            fNotEmpty.wait(lock, [this]() { return fReady > 0 || fClosed; });
+            fStats.computeStallSeconds += Seconds(start);
+        }
+        if (fReady == 0) return nullptr;
+        fStats.batches++;
+        fStats.occupancy += fReady;
+        return &fSlots[fHead];
+    }
+
+    // Calculo: el lote de BeginRead vuelve a estar libre
+    void EndRead() {
+        {
+            std::lock_guard<std::mutex> lock(fMutex);
+            fHead = (fHead + 1) % fSlots.size();
+            fReady--;
+        }
+        fNotFull.notify_one();
+    }
+
+    const PipelineStats& Stats() const { return fStats; }
+
+private:
+    static Double_t Seconds(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<Double_t>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    std::vector<EventBatch> fSlots;
+    Int_t fHead;  // Primer lote listo
+    Int_t fReady; // Lotes listos
+    bool fClosed;
+    std::mutex fMutex;
+    std::condition_variable fNotFull;
+    std::condition_variable fNotEmpty;
+    PipelineStats fStats;
+};
+
+#endif // EVENTRING_H
@@ -0,0 +1,152 @@
+#ifndef EVENTVIEW_H
+#define EVENTVIEW_H
+
+#include <Rtypes.h>
+#include <algorithm>
+#include <vector>
+
+// Ramas Jet_* y Track_* de un evento que usa el analisis. El analisis solo lee el evento
+// a traves de esta vista: puede apuntar directamente a los arrays de DelphesReader (lectura en
+// el mismo hilo) o a la copia del evento en un lote de eventos (EventBatch).
+struct EventView {
+    Int_t Jet_size;
+    const Float_t* Jet_PT;
+    const Float_t* Jet_Eta;
+    const Float_t* Jet_Phi;
+    const Float_t* Jet_Mass;
+    const Int_t* Jet_NCharged;
+    const Int_t* Jet_NNeutrals;
+    const UInt_t* Jet_Flavor;
+    const UInt_t* Jet_BTag;
+
+    Int_t Track_size;
+    const Float_t* Track_PT;
+    const Float_t* Track_Eta;
+    const Float_t* Track_Phi;
+    const Int_t* Track_Charge;
+    const Float_t* Track_D0;
+    const Float_t* Track_DZ;
+
+    // Vista sobre las ramas del evento cargado en el arbol (DelphesReader)
+    template <class Tree>
+    static EventView Of(const Tree& t) {
+        return {t.Jet_size, t.Jet_PT, t.Jet_Eta, t.Jet_Phi, t.Jet_Mass, t.Jet_NCharged, t.Jet_NNeutrals,
+                t.Jet_Flavor, t.Jet_BTag, t.Track_size, t.Track_PT, t.Track_Eta, t.Track_Phi,
+                t.Track_Charge, t.Track_D0, t.Track_DZ};
+    }
+};
+
+// Lote de hasta kEvents eventos copiados del arbol, en columnas (SoA) por rama. Los
+// jets y las trazas de todos los eventos del lote son contiguos en sus columnas; las
+// tablas de posiciones dan el rango de cada evento: el evento k ocupa
+// [jetOffset[k], jetOffset[k + 1]) en las columnas de jets y lo mismo con trackOffset en
+// las de trazas. La memoria se reserva al construir el lote para el maximo de jets y
+// trazas por evento que se espera, y crece si un evento no cabe; solo se copian los
+// elementos presentes.
+class EventBatch {
+public:
+    static constexpr Int_t kEvents = 256;
+
+    Int_t size;                    // Eventos en el lote
+    Long64_t entry[kEvents];       // Entrada del TChain de cada evento
+    Int_t bytes[kEvents];          // Bytes leidos por GetEntry
+    Int_t jetOffset[kEvents + 1];  // Primer jet de cada evento (y final del ultimo)
+    Int_t trackOffset[kEvents + 1]; // Primera traza de cada evento (y final de la ultima)
+
+    // Columnas de jets
+    std::vector<Float_t> jetPT, jetEta, jetPhi, jetMass;
+    std::vector<Int_t> jetNCharged, jetNNeutrals;
+    std::vector<UInt_t> jetFlavor, jetBTag;
+
+    // Columnas de trazas
+    std::vector<Float_t> trackPT, trackEta, trackPhi, trackD0, trackDZ;
+    std::vector<Int_t> trackCharge;
+
+    EventBatch(Int_t maxJets, Int_t maxTracks)
+        : jetPT(kEvents * maxJets), jetEta(kEvents * maxJets), jetPhi(kEvents * maxJets), jetMass(kEvents * maxJets),
+          jetNCharged(kEvents * maxJets), jetNNeutrals(kEvents * maxJets),
+          jetFlavor(kEvents * maxJets), jetBTag(kEvents * maxJets),
+          trackPT(kEvents * maxTracks), trackEta(kEvents * maxTracks), trackPhi(kEvents * maxTracks),
+          trackD0(kEvents * maxTracks), trackDZ(kEvents * maxTracks), trackCharge(kEvents * maxTracks) {
+        Clear();
+    }
+
+    // Vacia el lote (la memoria se conserva)
+    void Clear() {
+        size = 0;
+        jetOffset[0] = 0;
+        trackOffset[0] = 0;
+    }
+
+    // Copia el evento cargado en el arbol al final del lote
+    template <class Tree>
+    void Add(Long64_t jentry, Int_t nbytes, const Tree& t) {
+        Int_t k = size++;
+        entry[k] = jentry;
+        bytes[k] = nbytes;
+
+        Int_t j = jetOffset[k];
+        Int_t nJets = t.Jet_size;
+        jetOffset[k + 1] = j + nJets;
+        if (j + nJets > (Int_t)jetPT.size()) GrowJets(j + nJets);
+        std::copy_n(t.Jet_PT, nJets, &jetPT[j]);
+        std::copy_n(t.Jet_Eta, nJets, &jetEta[j]);
+        std::copy_n(t.Jet_Phi, nJets, &jetPhi[j]);
+        std::copy_n(t.Jet_Mass, nJets, &jetMass[j]);
+        std::copy_n(t.Jet_NCharged, nJets, &jetNCharged[j]);
+        std::copy_n(t.Jet_NNeutrals, nJets, &jetNNeutrals[j]);
+        std::copy_n(t.Jet_Flavor, nJets, &jetFlavor[j]);
+        std::copy_n(t.Jet_BTag, nJets, &jetBTag[j]);
+
+        Int_t m = trackOffset[k];
+        Int_t nTracks = t.Track_size;
+        trackOffset[k + 1] = m + nTracks;
+        if (m + nTracks > (Int_t)trackPT.size()) GrowTracks(m + nTracks);
+        std::copy_n(t.Track_PT, nTracks, &trackPT[m]);
+        std::copy_n(t.Track_Eta, nTracks, &trackEta[m]);
+        std::copy_n(t.Track_Phi, nTracks, &trackPhi[m]);
+        std::copy_n(t.Track_D0, nTracks, &trackD0[m]);
+        std::copy_n(t.Track_DZ, nTracks, &trackDZ[m]);
+        std::copy_n(t.Track_Charge, nTracks, &trackCharge[m]);
+    }
+
+    // Anota un evento que no se analiza (sin jets ni trazas), para que el lote siga
+    // cubriendo todas sus entradas
+    void Skip(Long64_t jentry, Int_t nbytes) {
+        Int_t k = size++;
+        entry[k] = jentry;
+        bytes[k] = nbytes;
+        jetOffset[k + 1] = jetOffset[k];
+        trackOffset[k + 1] = trackOffset[k];
+    }
+
+    // Jets del evento k
+    Int_t JetCount(Int_t k) const { return jetOffset[k + 1] - jetOffset[k]; }
+
+    // Vista del evento k del lote (valida hasta que el lote se reutiliza)
+    EventView View(Int_t k) const {
+        Int_t j = jetOffset[k];
+        Int_t m = trackOffset[k];
+        return {JetCount(k), &jetPT[j], &jetEta[j], &jetPhi[j], &jetMass[j], &jetNCharged[j], &jetNNeutrals[j],
+                &jetFlavor[j], &jetBTag[j], trackOffset[k + 1] - m, &trackPT[m], &trackEta[m], &trackPhi[m],
+                &trackCharge[m], &trackD0[m], &trackDZ[m]};
+    }
+
+private:
+    // Los eventos con mas jets o trazas que los previstos al construir amplian las columnas
+    // (al doble, como minimo), conservando los eventos ya copiados
+    void GrowJets(Int_t n) {
+        n = std::max<Int_t>(n, 2 * jetPT.size());
+        for (auto* column : {&jetPT, &jetEta, &jetPhi, &jetMass}) column->resize(n);
+        for (auto* column : {&jetNCharged, &jetNNeutrals}) column->resize(n);
+        for (auto* column : {&jetFlavor, &jetBTag}) column->resize(n);
+    }
+
+    void GrowTracks(Int_t n) {
+        n = std::max<Int_t>(n, 2 * trackPT.size());
+        for (auto* column : {&trackPT, &trackEta, &trackPhi, &trackD0, &trackDZ}) column->resize(n);
+        trackCharge.resize(n);
+    }
+};
+
+#endif // EVENTVIEW_H
@@ -0,0 +1,38 @@
+#ifndef FEATUREBLOCK_H
+#define FEATUREBLOCK_H
+
+#include <Rtypes.h>
+#include <vector>
+#include "JetFeatures.h"
+
+// Registros de variables de un lote de eventos, agrupados por la copia de los histogramas
+// que llenan (pareja o jet principal). El analisis por lotes los acumula y
+// HistogramSet::Fill los llena de una vez con FillN. Los registros de cada copia quedan en
+// el orden de los eventos, asi que los histogramas son los mismos que llenando evento a
+// evento. La capacidad se reserva al construir: anadir registros no reserva memoria.
+struct FeatureBlock {
+    std::vector<EventFeatures> events;
+    std::vector<std::vector<PairFeatures>> pairs; // Por pareja (HistogramSet::PairIndex)
+    std::vector<std::vector<JetFeatures>> jets;   // Por jet principal
+    std::vector<std::vector<RadialPoint>> points; // Por jet principal; se vacian al llenarse (PointsFull)
+
+    FeatureBlock(Int_t nEvents, Int_t nJets, Int_t pointsPerJet)
+        : pairs(nJets * (nJets - 1) / 2), jets(nJets), points(nJets) {
+        events.reserve(nEvents);
+        for (auto& list : pairs) list.reserve(nEvents);
+        for (auto& list : jets) list.reserve(nEvents);
+        for (auto& list : points) list.reserve(pointsPerJet);
+    }
+
+    // Puntos del perfil radial del jet sin sitio para otro
+    bool PointsFull(Int_t jet) const { return points[jet].size() == points[jet].capacity(); }
+
+    void Clear() {
+        events.clear();
+        for (auto& list : pairs) list.clear();
+        for (auto& list : jets) list.clear();
+        for (auto& list : points) list.clear();
+    }
+};
+
+#endif // FEATUREBLOCK_H
@@ -0,0 +1,47 @@
+#ifndef FILESYSTEM_H
+#define FILESYSTEM_H
+
+#include <TSystem.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <iostream>
+#include <string>
+
+inline bool IsDirectory(const std::string& path) {
+    struct stat st;
+    return stat(path.c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+}
+
+inline bool IsFile(const std::string& path) {
+    struct stat st;
+    return stat(path.c_str(), &st) == 0 && S_ISREG(st.st_mode);
+}
+
+// Crea el directorio dir y los que le faltan por encima. Devuelve false (tras imprimir el
+// motivo) si no existe y no se puede crear, o si ya hay un archivo con ese nombre
+inline bool MakeDirectory(const std::string& dir) {
+    // gSystem->mkdir falla si el directorio ya existe; si otro proceso lo crea a la vez,
+    // tambien vale
+    if (dir.empty() || IsDirectory(dir)) return true;
+    if (gSystem->mkdir(dir.c_str(), kTRUE) == 0 || IsDirectory(dir)) return true;
+    std::cerr << "Error: no se pudo crear el directorio " << dir << std::endl;
+    return false;
+}
+
+// Crea el directorio que contiene path (nada si path no tiene directorio)
+inline bool MakeParentDirectory(const std::string& path) {
+    size_t slash = path.rfind('/');
+    return slash == std::string::npos || MakeDirectory(path.substr(0, slash));
+}
+
+// Lleva a disco el contenido de un archivo, o las entradas de un directorio (para que
+// un rename o un archivo nuevo sobrevivan a una caida). false si falla
+inline bool SyncPath(const std::string& path) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    bool synced = (::fsync(fd) == 0);
+    return (::close(fd) == 0) && synced;
+}
+
+#endif // FILESYSTEM_H
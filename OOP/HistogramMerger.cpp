@@ -0,0 +1,124 @@
+#include "HistogramMerger.h"
+#include "FileSystem.h"
+#include <TFile.h>
+#include <TKey.h>
+#include <TROOT.h>
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <thread>
+
+bool HistogramMerger::Read(const std::string& path, HistogramList& histograms) {
+    TFile file(path.c_str(), "READ");
+    if (file.IsZombie()) {
+        std::cerr << "Error: no se pudo abrir " << path << std::endl;
+        return false;
+    }
+    for (TObject* object : *file.GetListOfKeys()) {
+        TKey* key = static_cast<TKey*>(object);
+        TH1* h = dynamic_cast<TH1*>(key->ReadObj());
+        if (!h) continue;
+        h->SetDirectory(nullptr); // La copia sobrevive al cierre del archivo
+        histograms.push_back(h);
+    }
+    return true;
+}
+
+bool HistogramMerger::Add(HistogramList& a, HistogramList& b, const std::string& bPath) {
+    bool consistent = a.size() == b.size();
+    for (size_t k = 0; consistent && k < a.size(); k++) {
+        consistent = std::strcmp(a[k]->GetName(), b[k]->GetName()) == 0 && a[k]->Add(b[k]);
+    }
+    if (!consistent) {
+        std::cerr << "Error: los histogramas de " << bPath << " no coinciden con los de la primera entrada" << std::endl;
+    }
+    Delete(b);
+    return consistent;
+}
+
+void HistogramMerger::Delete(HistogramList& histograms) {
+    for (auto* h : histograms) {
+        delete h;
+    }
+    histograms.clear();
+}
+
+bool HistogramMerger::Merge(const std::vector<std::string>& inputs, const std::string& output, Int_t nThreads) {
+    if (inputs.empty()) return false;
+    TH1::AddDirectory(kFALSE);
+    ROOT::EnableThreadSafety();
+
+    // Cada hilo suma un bloque contiguo de entradas, en orden
+    Int_t nFiles = inputs.size();
+    nThreads = std::max(1, std::min(nThreads, nFiles));
+    std::vector<HistogramList> partial(nThreads);
+    std::vector<char> ok(nThreads, 1);
+    std::vector<std::thread> threads;
+
+    for (Int_t k = 0; k < nThreads; k++) {
+        threads.emplace_back([&, k]() {
+            Int_t begin = (Long64_t)k * nFiles / nThreads;
+            Int_t end = (Long64_t)(k + 1) * nFiles / nThreads;
+            for (Int_t f = begin; f < end && ok[k]; f++) {
+                HistogramList histograms;
+                if (!Read(inputs[f], histograms)) {
+                    ok[k] = 0;
+                } else if (f == begin) {
+                    partial[k].swap(histograms);
+                } else {
+                    ok[k] = Add(partial[k], histograms, inputs[f]);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Reduccion en arbol: en cada ronda, el bloque k + stride se suma al bloque k
+    for (Int_t stride = 1; stride < nThreads; stride *= 2) {
+        threads.clear();
+        for (Int_t k = 0; k + stride < nThreads; k += 2 * stride) {
+            threads.emplace_back([&, k, stride]() {
+                Int_t first = (Long64_t)(k + stride) * nFiles / nThreads;
+                if (ok[k] && ok[k + stride]) {
+                    ok[k] = Add(partial[k], partial[k + stride], inputs[first]);
+                } else {
+                    ok[k] = 0;
+                    Delete(partial[k + stride]);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    HistogramList& merged = partial[0];
+    if (!ok[0]) {
+        Delete(merged);
+        return false;
+    }
+
+    // Escribir el resultado con el orden de la primera entrada
+    if (!MakeParentDirectory(output)) {
+        Delete(merged);
+        return false;
+    }
+    TFile outFile(output.c_str(), "RECREATE");
+    bool written = !outFile.IsZombie();
+    for (size_t k = 0; k < merged.size() && written; k++) {
+        written = merged[k]->Write() > 0;
+    }
+    outFile.Close();
+    if (!written || outFile.TestBit(TFile::kWriteError)) {
+        std::cerr << "Error: no se pudo escribir " << output << std::endl;
+        Delete(merged);
+        return false;
+    }
+
+    std::cout << nFiles << " salidas parciales unidas en " << output << " (" << merged.size()
+              << " histogramas, " << nThreads << " hilos)" << std::endl;
+    Delete(merged);
+    return true;
+}
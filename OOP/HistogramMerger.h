@@ -0,0 +1,29 @@
+#ifndef HISTOGRAMMERGER_H
+#define HISTOGRAMMERGER_H
+
+#include <TH1.h>
+#include <string>
+#include <vector>
+
+// Union de las salidas parciales (histograms.root) de varios trabajos en una sola.
+// Cada hilo lee y suma un bloque contiguo de archivos; las sumas parciales se combinan
+// despues por parejas en un arbol (log2(hilos) rondas en paralelo). Todas las entradas
+// deben tener los mismos histogramas, en el mismo orden que la primera.
+class HistogramMerger {
+public:
+    // Escribe la suma de inputs en output; devuelve false si alguna entrada no es valida
+    static bool Merge(const std::vector<std::string>& inputs, const std::string& output, Int_t nThreads);
+
+    using HistogramList = std::vector<TH1*>;
+
+    // Lee todos los histogramas de path (en el orden de las claves)
+    static bool Read(const std::string& path, HistogramList& histograms);
+
+    static void Delete(HistogramList& histograms);
+
+private:
+    // Suma b en a (mismos nombres, mismo orden) y libera b
+    static bool Add(HistogramList& a, HistogramList& b, const std::string& bPath);
+};
+
+#endif // HISTOGRAMMERGER_H
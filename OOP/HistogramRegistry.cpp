@@ -0,0 +1,397 @@
+#include "HistogramRegistry.h"
+#include <iostream>
+
+// Condiciones de llenado: sin particulas en el cono no hay perfil radial, y sin pT
+// parcial no hay fracciones de pT cargado y neutro
+static bool HasTracks(const JetFeatures& f) { return f.sumPT != 0.0; }
+static bool HasTotalPT(const JetFeatures& f) { return f.sumPT != 0.0 && f.totalPT != 0; }
+
+// Colores de linea de las copias: los 9 primeros de ROOT (el 10 es blanco) y despues
+// colores de la rueda, para N jets principales grandes y sus N(N-1)/2 parejas
+static Color_t LineColor(Int_t k) {
+    static const Color_t wheel[] = {kOrange + 7, kAzure + 7, kSpring - 6, kViolet + 6, kPink + 1, kTeal + 3, kGray + 2};
+    return (k < 9) ? k + 1 : wheel[(k - 9) % 7];
+}
+
+const HistogramRegistry& HistogramRegistry::Default() {
+    static const HistogramRegistry registry;
+    return registry;
+}
+
+bool HistogramRegistry::Contains(const std::string& name) const {
+    for (const auto& o : eventObservables) if (o.name == name) return true;
+    for (const auto& o : pairObservables) if (o.name == name) return true;
+    for (const auto& o : jetObservables) if (o.name == name) return true;
+    for (const auto& o : pointObservables) if (o.name == name) return true;
+    return false;
+}
+
+void HistogramRegistry::CheckConfig(const AnalyzerConfig& config) const {
+    // Avisar de nombres de la configuracion que no estan en el registro
+    for (const auto* names : {&config.observables, &config.disabledObservables}) {
+        for (const auto& name : *names) {
+            if (!Contains(name)) {
+                std::cerr << "Aviso: el observable " << name << " no esta en el registro" << std::endl;
+            }
+        }
+    }
+}
+
+HistogramRegistry::HistogramRegistry() {
+    // Histograma de jets por evento
+    eventObservables.push_back(
+        Hist1D<EventFeatures>("hJetsPerEvent", "Numero de Jets por Evento", 10, 0, 10,
+                              [](const EventFeatures& f) -> Double_t { return f.nJets; })
+            .Plot("JetsPerEvent", "Jets por evento"));
+
+    // Delta R entre los jets principales, por parejas
+    pairObservables.push_back(
+        Hist1D<PairFeatures>("hDeltaRPar", "Delta R entre los primeros %d jets, por parejas", 50, 0, 10,
+                             [](const PairFeatures& f) { return f.deltaR; })
+            .Plot("RPar", "R entre las parejas de los primeros %d jets")
+            .Needs(kNeedsPairs));
+
+    // pT, Eta y Phi de los jets
+    jetObservables.push_back(
+        Hist1D<JetFeatures>("hJetPT", "pT del Jet", 100, 5, 210, [](const JetFeatures& f) { return f.pt; })
+            .Plot("PTjets", "pT de los Jets"));
+    jetObservables.push_back(
+        Hist1D<JetFeatures>("hJetEta", "Eta del Jet", 100, -5.5, 5.5, [](const JetFeatures& f) { return f.eta; })
+            .Plot("Etajets", "Eta de los Jets"));
+    jetObservables.push_back(
+        Hist1D<JetFeatures>("hJetPhi", "Phi del Jet", 100, -3.5, 3.5, [](const JetFeatures& f) { return f.phi; })
+            .Plot("Phijets", "Phi de los Jets")
+            .LinearY());
+
+    // Numero de particulas cargadas y neutras por jet
+    jetObservables.push_back(
+        Hist1D<JetFeatures>("hChargedParticles", "Numero de particulas cargadas del Jet", 27, 0, 27,
+                            [](const JetFeatures& f) -> Double_t { return f.nCharged; })
+            .Plot("NCharged", "Numero de particulas cargadas por jet"));
+    jetObservables.push_back(
+        Hist1D<JetFeatures>("hNeutralsParticles", "Numero de particulas neutras del Jet", 27, 0, 27,
+                            [](const JetFeatures& f) -> Double_t { return f.nNeutrals; })
+            .Plot("NNeutrals", "Numero de particulas neutras por jet"));
+
+    // Fraccion de pT cargado y neutro del jet
+    jetObservables.push_back(
+        Hist1D<JetFeatures>("hChargedPTFraction", "Fraccion de pT cargado del Jet", 100, 0, 1,
+                            [](const JetFeatures& f) { return f.chargedPTFraction; })
+            .Plot("ChargedPTFraction", "Fraccion de pT cargado del Jet")
+            .Needs(kNeedsTracks).When(HasTotalPT));
+    jetObservables.push_back(
+        Hist1D<JetFeatures>("hNeutralPTFraction", "Fraccion de pT neutro del Jet", 100, 0, 1,
+                            [](const JetFeatures& f) { return f.neutralPTFraction; })
+            .Plot("NeutralPTFraction", "Fraccion de pT neutro del Jet")
+            .Needs(kNeedsTracks).When(HasTotalPT).LegendLeft());
+
+    // pT promedio de las particulas y particulas por debajo/encima del promedio
+    jetObservables.push_back(
+        Hist1D<JetFeatures>("hAveragePT", "pT promedio de las particulas del Jet", 100, 0, 60,
+                            [](const JetFeatures& f) { return f.averagePT; })
+            .Plot("AveragePT", "pT promedio de las particulas del Jet")
+            .Needs(kNeedsTracks));
+    jetObservables.push_back(
+        Hist1D<JetFeatures>("hParticlesBelowAvgPT", "Numero de particulas con pT < pT promedio del Jet", 120, 0, 120,
+                            [](const JetFeatures& f) -> Double_t { return f.particlesBelowAvgPT; })
+            .Plot("ParticlesBelowAvgPT", "Numero de particulas con pT < pT promedio del Jet")
+            .Needs(kNeedsTracks));
+    jetObservables.push_back(
+        Hist1D<JetFeatures>("hParticlesAboveAvgPT", "Numero de particulas con pT > pT promedio del Jet", 60, 0, 60,
+                            [](const JetFeatures& f) -> Double_t { return f.particlesAboveAvgPT; })
+            .Plot("ParticlesAboveAvgPT", "Numero de particulas con pT > pT promedio del Jet")
+            .Needs(kNeedsTracks));
+
+    // Cocientes de pT de las particulas extremas con el pT del jet
+    jetObservables.push_back(
+        Hist1D<JetFeatures>("hMaxPTRatio", "pT(par_max_pT) / pT(j_r) del Jet", 100, 0, 3.5,
+                            [](const JetFeatures& f) { return f.maxPTRatio; })
+            .Plot("MaxPTRatio", "pT(par_max_pT) / pT(j_r) del Jet")
+            .Needs(kNeedsTracks));
+    jetObservables.push_back(
+        Hist1D<JetFeatures>("hMinPTRatio", "pT(par_min_pT) / pT(j_r) del Jet", 100, 0, 1,
+                            [](const JetFeatures& f) { return f.minPTRatio; })
+            .Plot("MinPTRatio", "pT(par_min_pT) / pT(j_r) del Jet")
+            .Needs(kNeedsTracks));
+    jetObservables.push_back(
+        Hist1D<JetFeatures>("hMaxDRRatio", "pT(par_max_DR) / pT(j_r) del Jet", 100, 0, 2.5,
+                            [](const JetFeatures& f) { return f.maxDRRatio; })
+            .Plot("MaxDRRatio", "pT(par_max_DR) / pT(j_r) del Jet")
+            .Needs(kNeedsTracks));
+    jetObservables.push_back(
+        Hist1D<JetFeatures>("hMinDRRatio", "pT(par_min_DR) / pT(j_r) del Jet", 100, 0, 2.5,
+                            [](const JetFeatures& f) { return f.minDRRatio; })
+            .Plot("MinDRRatio", "pT(par_min_DR) / pT(j_r) del Jet")
+            .Needs(kNeedsTracks));
+
+    // DeltaR de las particulas extremas al eje del jet
+    jetObservables.push_back(
+        Hist1D<JetFeatures>("hDeltaRMaxPT", "DeltaR(par_max_pT, j_r) del Jet", 100, 0, 0.4,
+                            [](const JetFeatures& f) { return f.deltaRMaxPT; })
+            .Plot("DeltaRMaxPT", "DeltaR(par_max_pT, j_r) del Jet")
+            .Needs(kNeedsTracks));
+    jetObservables.push_back(
+        Hist1D<JetFeatures>("hDeltaRMinPT", "DeltaR(par_min_pT, j_r) del Jet", 100, 0, 0.4,
+                            [](const JetFeatures& f) { return f.deltaRMinPT; })
+            .Plot("DeltaRMinPT", "DeltaR(par_min_pT, j_r) del Jet")
+            .Needs(kNeedsTracks).LegendLeft());
+    jetObservables.push_back(
+        Hist1D<JetFeatures>("hDeltaRMaxDR", "DeltaR(par_max_DR, j_r) del Jet", 100, 0, 0.4,
+                            [](const JetFeatures& f) { return f.deltaRMaxDR; })
+            .Plot("DeltaRMaxDR", "DeltaR(par_max_DR, j_r) del Jet")
+            .Needs(kNeedsTracks).LegendLeft());
+    jetObservables.push_back(
+        Hist1D<JetFeatures>("hDeltaRMinDR", "DeltaR(par_min_DR, j_r) del Jet", 100, 0, 0.4,
+                            [](const JetFeatures& f) { return f.deltaRMinDR; })
+            .Plot("DeltaRMinDR", "DeltaR(par_min_DR, j_r) del Jet")
+            .Needs(kNeedsTracks));
+
+    // pT(par_max_pT) - pT(par_min_pT)
+    jetObservables.push_back(
+        Hist1D<JetFeatures>("hPTDifference", "pT(par_max_pT) - pT(par_min_pT) del Jet", 100, 0, 200,
+                            [](const JetFeatures& f) { return f.ptDifference; })
+            .Plot("PTDifference", "pT(par_max_pT) - pT(par_min_pT) del Jet")
+            .Needs(kNeedsTracks));
+
+    // R al 50% y 95% del pT total del jet
+    jetObservables.push_back(
+        Hist1D<JetFeatures>("hR50PercentPT", "DeltaR para 50% pT total del Jet", 100, 0, 0.4,
+                            [](const JetFeatures& f) { return f.r50; })
+            .Plot("R50", "R al 50% del pT total del jet")
+            .Needs(kNeedsTracks | kNeedsProfile).When(HasTracks));
+    jetObservables.push_back(
+        Hist1D<JetFeatures>("hR95PercentPT", "DeltaR para 95% pT total del Jet", 100, 0, 0.4,
+                            [](const JetFeatures& f) { return f.r95; })
+            .Plot("R95", "R al 95% del pT total del jet")
+            .Needs(kNeedsTracks | kNeedsProfile).When(HasTracks).LegendLeft());
+
+    // Histogramas 2D por jet
+    jetObservables.push_back(
+        Hist2D<JetFeatures>("hPT_vs_Eta", "pT vs Eta del Jet %d", 50, -5.5, 5.5, 50, 0, 100,
+                            [](const JetFeatures& f) { return f.eta; },
+                            [](const JetFeatures& f) { return f.pt; })
+            .Axes("Eta", "pT (GeV)")
+            .Plot("PT_vs_Eta"));
+    jetObservables.push_back(
+        Hist2D<JetFeatures>("hCharged_vs_NeutralParticles", "Cargadas vs Neutras del Jet %d", 15, 0, 15, 15, 0, 15,
+                            [](const JetFeatures& f) -> Double_t { return f.nCharged; },
+                            [](const JetFeatures& f) -> Double_t { return f.nNeutrals; })
+            .Axes("Numero de Particulas Cargadas", "Numero de Particulas Neutras")
+            .Plot("Charged_vs_Neutral").Options({"COLZ", "CONT1"}));
+    jetObservables.push_back(
+        Hist2D<JetFeatures>("hChargedPTFraction_vs_NeutralPTFraction", "Fraccion de pT Cargado vs Neutro del Jet %d",
+                            10, 0, 1, 10, 0, 1,
+                            [](const JetFeatures& f) { return f.chargedPTFraction; },
+                            [](const JetFeatures& f) { return f.neutralPTFraction; })
+            .Axes("Fraccion de pT Cargado", "Fraccion de pT Neutro")
+            .Plot("ChargedPTFraction_vs_NeutralPTFraction")
+            .Needs(kNeedsTracks).When(HasTotalPT));
+    jetObservables.push_back(
+        Hist2D<JetFeatures>("hAveragePT_vs_TotalParticles", "pT Promedio vs Total Particulas del Jet %d",
+                            30, 0, 30, 40, 0, 20,
+                            [](const JetFeatures& f) -> Double_t { return f.nCharged + f.nNeutrals; },
+                            [](const JetFeatures& f) { return f.averagePT; })
+            .Axes("Numero Total de Particulas", "pT Promedio (GeV)")
+            .Plot("AveragePT_vs_TotalParticles").Options({"COLZ", "CONT1"})
+            .Needs(kNeedsTracks));
+    jetObservables.push_back(
+        Hist2D<JetFeatures>("hMaxPTRatio_vs_DeltaRMaxPT", "pT(par_max_pT) / pT(j_r) vs DeltaR(par_max_pT, j_r) del Jet %d",
+                            10, 0, 2, 10, 0, 0.4,
+                            [](const JetFeatures& f) { return f.maxPTRatio; },
+                            [](const JetFeatures& f) { return f.deltaRMaxPT; })
+            .Axes("pT(par_{max}^{PT}) / pT(j_{r})", "DeltaR(par_{max}^{PT}, j_{r})")
+            .Plot("MaxPTRatio_vs_DeltaRMaxPT").Options({"COLZ", "CONT1"})
+            .Needs(kNeedsTracks));
+    jetObservables.push_back(
+        Hist2D<JetFeatures>("hR50_vs_R95", "R50%% vs R95%% del Jet %d", 10, 0, 0.4, 10, 0, 0.4,
+                            [](const JetFeatures& f) { return f.r50; },
+                            [](const JetFeatures& f) { return f.r95; })
+            .Axes("R50% del pT total", "R95% del pT total")
+            .Plot("R50_vs_R95").Options({"COLZ", "CONT1"})
+            .Needs(kNeedsTracks | kNeedsProfile).When(HasTracks));
+
+    // Perfil radial: un llenado por particula del cono. D0 y DZ son los de la primera
+    // traza del evento (Track_D0[0], Track_DZ[0]), como en la version original
+    pointObservables.push_back(
+        Hist2D<RadialPoint>("hCumulativePT_vs_DeltaR", "DeltaR vs Porcentaje acumulado de pT del Jet %d",
+                            25, 0, 0.4, 25, 0, 1,
+                            [](const RadialPoint& p) { return p.deltaR; },
+                            [](const RadialPoint& p) { return p.cumulativeFraction; })
+            .Axes("#DeltaR", "Porcentaje acumulado de pT")
+            .Plot("CumulativePT_vs_DeltaR").Options({"SURF2", "CONT1"})
+            .Needs(kNeedsTracks | kNeedsProfile).Offset(1));
+    pointObservables.push_back(
+        Hist2D<RadialPoint>("hCumulativePT_vs_DZTrack", "DZTrack vs Porcentaje acumulado de pT del Jet %d",
+                            25, -4, 4, 25, 0, 1,
+                            [](const RadialPoint& p) { return p.dz; },
+                            [](const RadialPoint& p) { return p.cumulativeFraction; })
+            .Axes("DZTrack", "Porcentaje acumulado de pT")
+            .Plot("CumulativePT_vs_DZTrack").Options({"SURF2", "CONT1"})
+            .Needs(kNeedsTracks | kNeedsProfile).Offset(1));
+    pointObservables.push_back(
+        Hist2D<RadialPoint>("hCumulativePT_vs_D0Track", "D0Track vs Porcentaje acumulado de pT del Jet %d",
+                            50, -4, 4, 50, 0, 1,
+                            [](const RadialPoint& p) { return p.d0; },
+                            [](const RadialPoint& p) { return p.cumulativeFraction; })
+            .Axes("D0Track", "Porcentaje acumulado de pT")
+            .Plot("CumulativePT_vs_D0Track").Options({"SURF2", "CONT1"})
+            .Needs(kNeedsTracks | kNeedsProfile).Offset(1));
+    pointObservables.push_back(
+        Hist2D<RadialPoint>("hDeltaR_vs_DZTrack", "DeltaR vs DZTrack del Jet %d", 25, -4, 4, 25, 0, 0.4,
+                            [](const RadialPoint& p) { return p.dz; },
+                            [](const RadialPoint& p) { return p.deltaR; })
+            .Axes("DZTrack", "#DeltaR")
+            .Plot("hDeltaR_vs_DZTrack").Options({"SURF2", "CONT1"})
+            .Needs(kNeedsTracks | kNeedsProfile).Offset(1));
+    pointObservables.push_back(
+        Hist2D<RadialPoint>("hDeltaR_vs_D0Track", "DeltaR vs D0Track del Jet %d", 25, -4, 4, 25, 0, 0.4,
+                            [](const RadialPoint& p) { return p.d0; },
+                            [](const RadialPoint& p) { return p.deltaR; })
+            .Axes("D0Track", "#DeltaR")
+            .Plot("hDeltaR_vs_D0Track").Options({"SURF2", "CONT1"})
+            .Needs(kNeedsTracks | kNeedsProfile).Offset(1));
+}
+
+HistogramSet::HistogramSet(const HistogramRegistry& registry, const AnalyzerConfig& config, Int_t nJets)
+    : fJets(nJets), fNeeds(0) {
+    Book(registry.eventObservables, config, 1, fEvent);
+    Book(registry.pairObservables, config, nJets * (nJets - 1) / 2, fPair);
+    Book(registry.jetObservables, config, nJets, fJet);
+    Book(registry.pointObservables, config, nJets, fPoint);
+
+    // fBooked ya no cambia de tamano: las listas de llenado pueden apuntar a sus copias
+    Link(fEvent);
+    Link(fPair);
+    Link(fJet);
+    Link(fPoint);
+}
+
+HistogramSet::~HistogramSet() {
+    // Liberar memoria de todos los histogramas reservados
+    for (auto& booked : fBooked) {
+        for (TH1* h : booked.copies) {
+            delete h;
+        }
+    }
+}
+
+template <class Record>
+void HistogramSet::Book(const std::vector<Observable<Record>>& defs, const AnalyzerConfig& config, Int_t nCopies,
+                        std::vector<Entry<Record>>& entries) {
+    for (const auto& def : defs) {
+        if (!config.IsEnabled(def.name)) continue;
+
+        Int_t n = (def.maxJets > 0 && def.scope != kPairScope) ? std::min(def.maxJets, nCopies) : nCopies;
+        if (n <= 0) continue;
+
+        // Copias inclusivas y, separando por sabor, una rebanada por categoria y copia
+        // (c = -1: la inclusiva)
+        bool split = config.flavorSplit && Splittable(def);
+        Int_t total = split ? n * (1 + kFlavorCategories) : n;
+        Booked booked;
+        booked.info = &def;
+        for (Int_t s = 0; s < total; s++) {
+            Int_t k = s % n;
+            Int_t c = s / n - 1;
+            TString name = (c < 0) ? CopyName(def, k) : SliceName(def, k, c);
+            TString title = (def.Is2D()) ? Form(def.title.c_str(), k + 1)
+                            : (def.scope == kPairScope) ? Form(def.title.c_str(), fJets) : def.title.c_str();
+            if (c >= 0) title += TString::Format(" (jets %s)", FlavorCategoryName(c));
+            TH1* h;
+            if (def.Is2D()) {
+                h = new TH2F(name, title, def.nbinsX, def.xlow, def.xup, def.nbinsY, def.ylow, def.yup);
+            } else {
+                h = new TH1F(name, title, def.nbinsX, def.xlow, def.xup);
+            }
+            if (!def.xTitle.empty()) h->GetXaxis()->SetTitle(def.xTitle.c_str());
+            if (!def.yTitle.empty()) h->GetYaxis()->SetTitle(def.yTitle.c_str());
+            if (def.scope != kEventScope) {
+                h->SetLineColor(LineColor(k));
+                h->SetLineWidth(2);
+            }
+            booked.copies.push_back(h);
+
+            FillBuffer buffer;
+            buffer.x.resize(kFillBuffer);
+            if (def.Is2D()) buffer.y.resize(kFillBuffer);
+            booked.buffers.push_back(buffer);
+        }
+
+        entries.push_back({&def, fBooked.size(), nullptr, n, nullptr, split});
+        fBooked.push_back(booked);
+        fNeeds |= def.needs;
+        if (split) fNeeds |= kNeedsLabels;
+    }
+}
+
+template <class Record>
+void HistogramSet::Link(std::vector<Entry<Record>>& entries) {
+    for (auto& e : entries) {
+        e.copies = fBooked[e.booked].copies.data();
+        e.buffers = fBooked[e.booked].buffers.data();
+    }
+}
+
+void HistogramSet::Fill(const FeatureBlock& block) {
+    FillN(fEvent, 0, block.events);
+    for (size_t p = 0; p < block.pairs.size(); p++) {
+        FillN(fPair, p, block.pairs[p]);
+    }
+    for (size_t i = 0; i < block.jets.size(); i++) {
+        FillN(fJet, i, block.jets[i]);
+        FillN(fPoint, i, block.points[i]);
+    }
+}
+
+void HistogramSet::Flush() const {
+    for (const auto& booked : fBooked) {
+        for (size_t k = 0; k < booked.copies.size(); k++) {
+            Flush(booked.copies[k], booked.buffers[k]);
+        }
+    }
+}
+
+void HistogramSet::Add(const HistogramSet& other) {
+    Flush();
+    other.Flush();
+    for (size_t b = 0; b < fBooked.size(); b++) {
+        for (size_t k = 0; k < fBooked[b].copies.size(); k++) {
+            fBooked[b].copies[k]->Add(other.fBooked[b].copies[k]);
+        }
+    }
+}
+
+bool HistogramSet::Write() const {
+    Flush();
+    bool written = true;
+    for (const auto& booked : fBooked) {
+        for (TH1* h : booked.copies) {
+            written = (h->Write() > 0) && written;
+        }
+    }
+    return written;
+}
+
+bool HistogramSet::Read(TDirectory& dir) {
+    Flush();
+
+    // Primero se leen todos: si falta alguno, el conjunto no cambia
+    std::vector<TH1*> stored;
+    bool complete = true;
+    for (const auto& booked : fBooked) {
+        for (TH1* h : booked.copies) {
+            TH1* s = complete ? dynamic_cast<TH1*>(dir.Get(h->GetName())) : nullptr;
+            complete = complete && s;
+            stored.push_back(s);
+        }
+    }
+
+    size_t k = 0;
+    for (const auto& booked : fBooked) {
+        for (TH1* h : booked.copies) {
+            if (complete) h->Add(stored[k]);
+            delete stored[k++];
+        }
+    }
+    return complete;
+}
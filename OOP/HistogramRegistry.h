@@ -0,0 +1,315 @@
+#ifndef HISTOGRAMREGISTRY_H
+#define HISTOGRAMREGISTRY_H
+
+#include <TDirectory.h>
+#include <TH1F.h>
+#include <TH2F.h>
+#include <string>
+#include <vector>
+#include "AnalyzerConfig.h"
+#include "JetFeatures.h"
+#include "FeatureBlock.h"
+
+// Alcance de un observable: cuantas copias se reservan y con que registro se llenan
+enum ObservableScope {
+    kEventScope, // Una copia, un llenado por evento (EventFeatures)
+    kPairScope,  // Una copia por pareja de jets principales (PairFeatures)
+    kJetScope,   // Una copia por jet principal (JetFeatures)
+    kPointScope  // Una copia por jet principal, un llenado por particula del cono (RadialPoint)
+};
+
+template <class Record> struct ScopeOf;
+template <> struct ScopeOf<EventFeatures> { static constexpr ObservableScope value = kEventScope; };
+template <> struct ScopeOf<PairFeatures> { static constexpr ObservableScope value = kPairScope; };
+template <> struct ScopeOf<JetFeatures> { static constexpr ObservableScope value = kJetScope; };
+template <> struct ScopeOf<RadialPoint> { static constexpr ObservableScope value = kPointScope; };
+
+// Descripcion de un observable independiente del registro con el que se llena:
+// nombres, binning, jets que cubre y como se dibuja
+struct ObservableInfo {
+    ObservableScope scope;
+    std::string name;  // Nombre base: la copia k se llama name + (k + nameOffset)
+    std::string title; // Formato en 2D (numero de jet) y en parejas (numero de jets principales)
+    Int_t nameOffset;
+    Int_t maxJets;     // Jets principales cubiertos (0: todos)
+
+    // Binning (nbinsY = 0: histograma 1D)
+    Int_t nbinsX;
+    Double_t xlow, xup;
+    Int_t nbinsY;
+    Double_t ylow, yup;
+    std::string xTitle, yTitle;
+
+    // Grupos de variables que hay que calcular para llenarlo (kNeeds*)
+    UInt_t needs;
+
+    // Dibujo. 1D: todas las copias superpuestas en plotName.png. 2D: una imagen por
+    // copia y opcion, plotName_JetN.png para la primera y CONT_plotName_JetN.png para
+    // la segunda
+    std::string plotName;
+    std::string canvasTitle; // En parejas, formato con el numero de jets principales
+    bool logy;
+    bool legendLeft;
+    std::vector<std::string> drawOptions;
+
+    bool Is2D() const { return nbinsY > 0; }
+};
+
+// Observable sobre un registro de variables: valores de los ejes y condicion de llenado
+template <class Record>
+struct Observable : ObservableInfo {
+    typedef Double_t (*Value)(const Record&);
+    typedef bool (*Condition)(const Record&);
+
+    Value x;
+    Value y;        // nullptr en histogramas 1D
+    Condition when; // nullptr: se llena siempre
+
+    Observable(const char* name, const char* title, Int_t nbinsX, Double_t xlow, Double_t xup,
+               Int_t nbinsY, Double_t ylow, Double_t yup, Value x, Value y)
+        : x(x), y(y), when(nullptr) {
+        this->scope = ScopeOf<Record>::value;
+        this->name = name;
+        this->title = title;
+        this->nameOffset = 0;
+        this->maxJets = 0;
+        this->nbinsX = nbinsX;
+        this->xlow = xlow;
+        this->xup = xup;
+        this->nbinsY = nbinsY;
+        this->ylow = ylow;
+        this->yup = yup;
+        this->needs = 0;
+        this->logy = true;
+        this->legendLeft = false;
+        this->drawOptions = {"COLZ"};
+    }
+
+    Observable& Plot(const char* plot, const char* canvas = "") { plotName = plot; canvasTitle = canvas; return *this; }
+    Observable& Axes(const char* xt, const char* yt) { xTitle = xt; yTitle = yt; return *this; }
+    Observable& Options(const std::vector<std::string>& options) { drawOptions = options; return *this; }
+    Observable& Needs(UInt_t groups) { needs |= groups; return *this; }
+    Observable& When(Condition condition) { when = condition; return *this; }
+    Observable& Offset(Int_t offset) { nameOffset = offset; return *this; }
+    Observable& Jets(Int_t n) { maxJets = n; return *this; }
+    Observable& LinearY() { logy = false; return *this; }
+    Observable& LegendLeft() { legendLeft = true; return *this; }
+};
+
+template <class Record>
+Observable<Record> Hist1D(const char* name, const char* title, Int_t nbins, Double_t low, Double_t up,
+                          typename Observable<Record>::Value x) {
+    return Observable<Record>(name, title, nbins, low, up, 0, 0, 0, x, nullptr);
+}
+
+template <class Record>
+Observable<Record> Hist2D(const char* name, const char* title, Int_t nbinsX, Double_t xlow, Double_t xup,
+                          Int_t nbinsY, Double_t ylow, Double_t yup,
+                          typename Observable<Record>::Value x, typename Observable<Record>::Value y) {
+    return Observable<Record>(name, title, nbinsX, xlow, xup, nbinsY, ylow, yup, x, y);
+}
+
+// Definicion de todos los observables del analisis, cada uno una sola vez
+class HistogramRegistry {
+public:
+    static const HistogramRegistry& Default();
+
+    bool Contains(const std::string& name) const;
+    void CheckConfig(const AnalyzerConfig& config) const;
+
+    std::vector<Observable<EventFeatures>> eventObservables;
+    std::vector<Observable<PairFeatures>> pairObservables;
+    std::vector<Observable<JetFeatures>> jetObservables;
+    std::vector<Observable<RadialPoint>> pointObservables;
+
+private:
+    HistogramRegistry();
+};
+
+// Histogramas reservados de los observables activos de un registro. Cada hilo tiene
+// su propio HistogramSet; reservar, llenar, combinar y escribir recorren el registro. Los
+// graficos se dibujan despues, desde el archivo escrito (PlotRenderer).
+//
+// Con config.flavorSplit, cada copia de los observables por jet y del perfil radial tiene
+// ademas una rebanada por categoria de sabor (SliceName). Cada valor llena la copia
+// inclusiva y la rebanada de la categoria de su jet, calculada una vez por jet; las copias
+// inclusivas son las mismas que sin rebanadas.
+class HistogramSet {
+public:
+    HistogramSet(const HistogramRegistry& registry, const AnalyzerConfig& config, Int_t nJets);
+    ~HistogramSet();
+    HistogramSet(const HistogramSet&) = delete;
+    HistogramSet& operator=(const HistogramSet&) = delete;
+
+    // Union de los grupos de variables que piden los observables activos
+    UInt_t Needs() const { return fNeeds; }
+
+    void FillEvent(const EventFeatures& f) { Fill(fEvent, 0, f); }
+    void FillPair(Int_t pair, const PairFeatures& f) { Fill(fPair, pair, f); }
+    void FillJet(Int_t jet, const JetFeatures& f) { Fill(fJet, jet, f); }
+    void FillPoint(Int_t jet, const RadialPoint& f) { Fill(fPoint, jet, f); }
+
+    // Los Fill* anteriores acumulan los valores de cada histograma y los llenan con FillN
+    // cada kFillBuffer valores; Flush llena los pendientes. Add, Write y Read vacian antes
+    // los pendientes, asi que el resultado es el mismo que llenando uno a uno.
+    void Flush() const;
+
+    // Llena con FillN, histograma a histograma, los registros de un lote
+    void Fill(const FeatureBlock& block);
+    void FillPoints(Int_t jet, const std::vector<RadialPoint>& points) { FillN(fPoint, jet, points); }
+
+    // Suma los histogramas de otro HistogramSet con la misma configuracion
+    void Add(const HistogramSet& other);
+
+    // Escribe los histogramas en el directorio actual; false si alguno no se escribe
+    bool Write() const;
+
+    // Suma los histogramas guardados con Write() en dir; false si falta alguno
+    bool Read(TDirectory& dir);
+
+    // Nombre de la copia k de un observable (la del evento no lleva indice)
+    static TString CopyName(const ObservableInfo& info, Int_t k) {
+        return (info.scope == kEventScope) ? TString(info.name) : TString::Format("%s%d", info.name.c_str(), k + info.nameOffset);
+    }
+
+    // Nombre de la rebanada de una categoria de sabor de la copia k
+    static TString SliceName(const ObservableInfo& info, Int_t k, Int_t category) {
+        return CopyName(info, k) + "_" + FlavorCategoryName(category);
+    }
+
+    // Observables que se pueden separar por sabor: los de un solo jet
+    static bool Splittable(const ObservableInfo& info) { return info.scope == kJetScope || info.scope == kPointScope; }
+
+    // Indice de la pareja (i, j), i < j, entre nJets jets principales
+    static Int_t PairIndex(Int_t i, Int_t j, Int_t nJets) { return i * (2 * nJets - i - 1) / 2 + (j - i - 1); }
+
+private:
+    // Valores pendientes de llenar de una copia (y solo en 2D)
+    struct FillBuffer {
+        std::vector<Double_t> x;
+        std::vector<Double_t> y;
+        Int_t size = 0;
+    };
+
+    // Copias inclusivas y, detras, las rebanadas por sabor: la de la categoria c de la
+    // copia k esta en nCopies + c * nCopies + k
+    struct Booked {
+        const ObservableInfo* info;
+        std::vector<TH1*> copies;
+        mutable std::vector<FillBuffer> buffers; // Uno por copia
+    };
+
+    template <class Record>
+    struct Entry {
+        const Observable<Record>* def;
+        size_t booked; // Posicion en fBooked
+        TH1** copies;
+        Int_t nCopies;
+        FillBuffer* buffers;
+        bool split;    // Con rebanadas por sabor
+    };
+
+    // Categoria de sabor del jet de un registro (solo los de un jet se separan)
+    static Int_t CategoryOf(const JetFeatures& f) { return f.category; }
+    static Int_t CategoryOf(const RadialPoint& p) { return p.category; }
+    template <class Record>
+    static Int_t CategoryOf(const Record&) { return 0; }
+
+    // Agrega un valor a los pendientes de la copia h
+    static void Push(TH1* h, FillBuffer& buffer, Double_t x, Double_t y) {
+        buffer.x[buffer.size] = x;
+        if (!buffer.y.empty()) buffer.y[buffer.size] = y;
+        if (++buffer.size == kFillBuffer) Flush(h, buffer);
+    }
+
+    template <class Record>
+    void Book(const std::vector<Observable<Record>>& defs, const AnalyzerConfig& config, Int_t nCopies,
+              std::vector<Entry<Record>>& entries);
+
+    template <class Record>
+    void Link(std::vector<Entry<Record>>& entries);
+
+    template <class Record>
+    static void Fill(std::vector<Entry<Record>>& entries, Int_t k, const Record& f) {
+        for (auto& e : entries) {
+            if (k >= e.nCopies) continue;
+            if (e.def->when && !e.def->when(f)) continue;
+            Double_t x = e.def->x(f);
+            Double_t y = e.def->y ? e.def->y(f) : 0;
+            Push(e.copies[k], e.buffers[k], x, y);
+            if (e.split) {
+                Int_t slice = e.nCopies * (1 + CategoryOf(f)) + k;
+                Push(e.copies[slice], e.buffers[slice], x, y);
+            }
+        }
+    }
+
+    // Llena la copia h con sus valores pendientes (pesos 1, en el orden en que llegaron)
+    static void Flush(TH1* h, FillBuffer& buffer) {
+        if (buffer.size == 0) return;
+        if (buffer.y.empty()) {
+            h->FillN(buffer.size, buffer.x.data(), nullptr);
+        } else {
+            static_cast<TH2*>(h)->FillN(buffer.size, buffer.x.data(), buffer.y.data(), nullptr);
+        }
+        buffer.size = 0;
+    }
+
+    // Copia k de cada observable: una llamada a FillN con los valores de los registros
+    // que cumplen su condicion, en el orden de los registros. Las rebanadas por sabor
+    // reciben los mismos valores por sus pendientes
+    template <class Record>
+    void FillN(std::vector<Entry<Record>>& entries, Int_t k, const std::vector<Record>& records) {
+        // Espacio para la capacidad de la lista: con listas de capacidad fija solo se reserva una vez
+        if (fX.size() < records.capacity()) {
+            fX.resize(records.capacity());
+            fY.resize(records.capacity());
+            fCategory.resize(records.capacity());
+        }
+        if (records.empty()) return;
+        for (auto& e : entries) {
+            if (k >= e.nCopies) continue;
+            Int_t m = 0;
+            for (const Record& f : records) {
+                if (e.def->when && !e.def->when(f)) continue;
+                fX[m] = e.def->x(f);
+                if (e.def->y) fY[m] = e.def->y(f);
+                fCategory[m] = CategoryOf(f);
+                m++;
+            }
+            Flush(e.copies[k], e.buffers[k]);
+            if (e.def->y) {
+                static_cast<TH2*>(e.copies[k])->FillN(m, fX.data(), fY.data(), nullptr);
+            } else {
+                e.copies[k]->FillN(m, fX.data(), nullptr);
+            }
+            if (!e.split) continue;
+            for (Int_t v = 0; v < m; v++) {
+                Int_t slice = e.nCopies * (1 + fCategory[v]) + k;
+                Push(e.copies[slice], e.buffers[slice], fX[v], e.def->y ? fY[v] : 0);
+            }
+        }
+    }
+
+    Int_t fJets;
+    UInt_t fNeeds;
+
+    // Observables reservados en el orden del registro
+    std::vector<Booked> fBooked;
+
+    // Listas de llenado por alcance (apuntan a las copias de fBooked)
+    std::vector<Entry<EventFeatures>> fEvent;
+    std::vector<Entry<PairFeatures>> fPair;
+    std::vector<Entry<JetFeatures>> fJet;
+    std::vector<Entry<RadialPoint>> fPoint;
+
+    // Valores pendientes por copia antes de llenar
+    static constexpr Int_t kFillBuffer = 256;
+
+    // Valores de los ejes para FillN y categoria de sabor de su jet
+    std::vector<Double_t> fX;
+    std::vector<Double_t> fY;
+    std::vector<Int_t> fCategory;
+};
+
+#endif // HISTOGRAMREGISTRY_H
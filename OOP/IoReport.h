@@ -0,0 +1,68 @@
+#ifndef IOREPORT_H
+#define IOREPORT_H
+
+#include <Rtypes.h>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Estadisticas de E/S de los hilos (config.ioStats): lecturas por archivo de entrada,
+// tomadas del TFile y de su TTreeCache antes de que el TChain pase al siguiente, y los
+// totales de TTreePerfStats. Cada hilo abre sus propios archivos, asi que los registros
+// de un mismo archivo se suman.
+struct IoReport {
+    struct File {
+        std::string path;
+        Long64_t entries = 0;        // Entradas leidas del archivo
+        Long64_t bytes = 0;          // Bytes leidos del disco (TFile::GetBytesRead)
+        Long64_t readCalls = 0;      // Llamadas de lectura al disco (TFile::GetReadCalls)
+        Double_t cachedBytes = 0;    // Bytes por la eficiencia del TTreeCache (media ponderada)
+        Double_t cachedBytesRel = 0; // Lo mismo con la eficiencia relativa
+    };
+
+    std::vector<File> files;
+
+    // Totales de TTreePerfStats
+    Long64_t perfReadCalls = 0;
+    Long64_t perfBytes = 0;
+    Double_t unzipSeconds = 0;
+    Double_t diskSeconds = 0;
+
+    void AddFile(const File& file) {
+        for (auto& f : files) {
+            if (f.path != file.path) continue;
+            f.entries += file.entries;
+            f.bytes += file.bytes;
+            f.readCalls += file.readCalls;
+            f.cachedBytes += file.cachedBytes;
+            f.cachedBytesRel += file.cachedBytesRel;
+            return;
+        }
+        files.push_back(file);
+    }
+
+    void Add(const IoReport& other) {
+        for (const auto& file : other.files) {
+            AddFile(file);
+        }
+        perfReadCalls += other.perfReadCalls;
+        perfBytes += other.perfBytes;
+        unzipSeconds += other.unzipSeconds;
+        diskSeconds += other.diskSeconds;
+    }
+
+    void Print(std::ostream& out) const {
+        out << "E/S por archivo (entradas, bytes leidos, lecturas, bytes por lectura, eficiencia del cache):" << std::endl;
+        for (const auto& f : files) {
+            Double_t perCall = (f.readCalls > 0) ? (Double_t)f.bytes / f.readCalls : 0;
+            Double_t efficiency = (f.bytes > 0) ? f.cachedBytes / f.bytes : 0;
+            Double_t efficiencyRel = (f.bytes > 0) ? f.cachedBytesRel / f.bytes : 0;
+            out << "  " << f.path << ": " << f.entries << ", " << f.bytes << ", " << f.readCalls << ", " << perCall
+                << ", " << 100 * efficiency << "% (relativa " << 100 * efficiencyRel << "%)" << std::endl;
+        }
+        out << "TTreePerfStats: " << perfReadCalls << " lecturas, " << perfBytes << " bytes, descompresion "
+            << unzipSeconds << " s, disco " << diskSeconds << " s (sumados sobre los hilos)" << std::endl;
+    }
+};
+
+#endif // IOREPORT_H
@@ -1,1175 +1,976 @@
 #include "JetAnalyzer.h"
+#include "AllocationCounter.h"
+#include "HistogramRegistry.cpp"
+#include "JetColumns.cpp"
+#include "Checkpoint.cpp"
+#include "DelphesReader.cpp"
+#include "SelectionIndex.cpp"
+#include "PlotRenderer.cpp"
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <fstream>
 #include <iostream>
-
-JetAnalyzer::JetAnalyzer(const std::vector<std::string>& inputFiles) {
-    // Inicializar TChain y agregar archivos
+#include <limits>
+#include <chrono>
+#include <thread>
+
+JetAnalyzer::JetAnalyzer(const std::vector<std::string>& inputFiles, const AnalyzerConfig& config,
+                         const std::vector<Long64_t>& fileEntries)
+    : fInputFiles(inputFiles), fBytesRead(0), fEventsRead(0), fEventsSelected(0), fConfig(config), histograms(nullptr),
+      columns(nullptr), records(nullptr), fTimer(!config.timingReport.empty()), fLoopWall(0), fLoopCpu(0),
+      fThreads(1), fPerfStats(nullptr), fIoTree(-1), fIoBegin(0), fIoEnd(0), fIoEntries(0), fIndex(nullptr), fRecordSelection(false), fScanComplete(true), fMaxTracks(0), profileScratch(nullptr), fSteadyAllocations(0) {
+    // Numero de jets principales
+    fLeadingJets = (config.leadingJets <= 0) ? kMaxLeadingJets : std::min(config.leadingJets, kMaxLeadingJets);
+    if (config.leadingJets > kMaxLeadingJets) {
+        std::cerr << "Aviso: " << config.leadingJets << " jets principales pedidos; se usan " << kMaxLeadingJets
+                  << std::endl;
+    }
+    particlesInJet.resize(fLeadingJets);
+    sums.resize(fLeadingJets);
+
+    // Inicializar TChain y agregar archivos; con sus entradas conocidas el TChain no los
+    // abre para contarlas
     fChain = new TChain("Delphes", "");
-    for (const auto& file : inputFiles) {
-        fChain->Add(file.c_str());
+    bool known = (fileEntries.size() == inputFiles.size());
+    for (size_t k = 0; k < inputFiles.size(); k++) {
+        if (known) {
+            fChain->Add(inputFiles[k].c_str(), fileEntries[k]);
+        } else {
+            fChain->Add(inputFiles[k].c_str());
+        }
     }
 
-    // Crear instancia de MyClass para acceder a las ramas del arbol
-    t = new MyClass(fChain);
-    nentries = t->fChain->GetEntries();
+    nentries = fChain->GetEntries();
+    if (fChain->GetNtrees() == (Int_t)inputFiles.size()) {
+        const Long64_t* offset = fChain->GetTreeOffset();
+        for (Int_t k = 0; k < fChain->GetNtrees(); k++) {
+            fFileEntries.push_back(offset[k + 1] - offset[k]);
+        }
+    }
+    fLastEntry = (config.lastEntry < 0) ? nentries : std::min(config.lastEntry, nentries);
+    fFirstEntry = std::min(std::max<Long64_t>(config.firstEntry, 0), fLastEntry);
 
     // Inicializar histogramas
     InitializeHistograms();
-}
 
-JetAnalyzer::~JetAnalyzer() {
-    // Liberar memoria de histogramas
-    delete hJetsPerEvent;
-
-    for (int i = 0; i < 4; i++) {
-        delete hJetPT[i];
-        delete hJetEta[i];
-        delete hJetPhi[i];
-        delete hChargedParticles[i];
-        delete hNeutralsParticles[i];
-        delete hChargedPTFraction[i];
-        delete hNeutralPTFraction[i];
-        delete hAveragePT[i];
-        delete hParticlesBelowAvgPT[i];
-        delete hParticlesAboveAvgPT[i];
-        delete hMaxPTRatio[i];
-        delete hMinPTRatio[i];
-        delete hMaxDRRatio[i];
-        delete hMinDRRatio[i];
-        delete hDeltaRMaxPT[i];
-        delete hDeltaRMinPT[i];
-        delete hDeltaRMaxDR[i];
-        delete hDeltaRMinDR[i];
-        delete hPTDifference[i];
-        delete hR50PercentPT[i];
-        delete hR95PercentPT[i];
-        delete hCumulativePT_vs_DeltaR[i];
-        delete hCumulativePT_vs_DZTrack[i];
-        delete hCumulativePT_vs_D0Track[i];
-        delete hDeltaR_vs_DZTrack[i];
-        delete hDeltaR_vs_D0Track[i];
-    }
+    // Leer solo las ramas que usa el analizador
+    t = new DelphesReader(fChain, fNeeds & kNeedsLabels);
+    ActivateBranches();
 
-    for (int i = 0; i < 6; i++) {
-        delete hDeltaRPar[i];
-    }
+    // Lecturas, bytes y tiempo de descompresion del TChain
+    if (config.ioStats) fPerfStats = new TTreePerfStats("ioperf", fChain);
+
+    // Columnas de trazas y memoria de trabajo para el maximo de trazas por evento del
+    // primer archivo; crecen si un archivo posterior tiene eventos con mas trazas
+    ReserveTracks(t->MaxTracks());
+    jets.reserve(fLeadingJets);
 
-    // Liberar memoria de TChain y MyClass
+    // Registros de un lote para el analisis por lotes
+    if (config.eventBlocks) records = new FeatureBlock(EventBatch::kEvents, fLeadingJets, kBlockPoints);
+}
+
+JetAnalyzer::~JetAnalyzer() {
+    // Liberar memoria de histogramas y de las columnas exportadas
+    delete histograms;
+    delete columns;
+    delete records;
+
+    // Liberar memoria de las estadisticas de E/S, TChain y lector
+    if (fPerfStats) fChain->SetPerfStats(nullptr);
+    delete fPerfStats;
     delete t;
     delete fChain;
 }
 
+void JetAnalyzer::ActivateBranches() {
+    // El lector solo activa las ramas de Jet y Track que se usan (las etiquetas de sabor,
+    // solo si se usan); cargar la primera entrada dimensiona sus arrays para el primer archivo
+    if (fFirstEntry < fLastEntry) t->LoadTree(fFirstEntry);
+
+    // TTreeCache de tamano fijo con las ramas activas, sin fase de aprendizaje: cada
+    // lectura trae los baskets de todas ellas para un rango de entradas. El cache se crea
+    // sobre el archivo de la primera entrada y el TChain lo conserva al cambiar de archivo
+    if (fConfig.treeCacheMB > 0 && fFirstEntry < fLastEntry) {
+        t->fChain->SetCacheSize(fConfig.treeCacheMB * 1024LL * 1024LL);
+        for (const char* branch : t->Branches()) {
+            // Las ramas de conteo (Jet_size, Track_size) se agregan con las de sus hojas
+            if (strchr(branch, '.')) t->fChain->AddBranchToCache(branch, kTRUE);
+        }
+        t->fChain->StopCacheLearningPhase();
+        t->fChain->SetClusterPrefetch(true);
+    }
+}
+
 void JetAnalyzer::InitializeHistograms() {
-    // Histograma de jets por evento
-    hJetsPerEvent = new TH1F("hJetsPerEvent", "Numero de Jets por Evento", 10, 0, 10);
-
-    // Inicializar histogramas para los primeros 4 jets
-    for (int i = 0; i < 4; i++) {
-        // pT de los jets
-        hJetPT[i] = new TH1F(Form("hJetPT%d", i), "pT del Jet", 100, 5, 210);
-        hJetPT[i]->SetLineColor(i+1);
-        hJetPT[i]->SetLineWidth(2);
-
-        // Eta de los jets
-        hJetEta[i] = new TH1F(Form("hJetEta%d", i), "Eta del Jet", 100, -5.5, 5.5);
-        hJetEta[i]->SetLineColor(i+1);
-        hJetEta[i]->SetLineWidth(2);
-
-        // Phi de los jets
-        hJetPhi[i] = new TH1F(Form("hJetPhi%d", i), "Phi del Jet", 100, -3.5, 3.5);
-        hJetPhi[i]->SetLineColor(i+1);
-        hJetPhi[i]->SetLineWidth(2);
-
-        // Numero de particulas cargadas por jet
-        hChargedParticles[i] = new TH1F(Form("hChargedParticles%d", i), "Numero de particulas cargadas del Jet", 27, 0, 27);
-        hChargedParticles[i]->SetLineColor(i+1);
-        hChargedParticles[i]->SetLineWidth(2);
-
-        // Numero de particulas neutras por jet
-        hNeutralsParticles[i] = new TH1F(Form("hNeutralsParticles%d", i), "Numero de particulas neutras del Jet", 27, 0, 27);
-        hNeutralsParticles[i]->SetLineColor(i+1);
-        hNeutralsParticles[i]->SetLineWidth(2);
-
-        // Fraccion de pT cargado del jet
-        hChargedPTFraction[i] = new TH1F(Form("hChargedPTFraction%d", i), "Fraccion de pT cargado del Jet", 100, 0, 1);
-        hChargedPTFraction[i]->SetLineColor(i+1);
-        hChargedPTFraction[i]->SetLineWidth(2);
-
-        // Fraccion de pT neutro del jet
-        hNeutralPTFraction[i] = new TH1F(Form("hNeutralPTFraction%d", i), "Fraccion de pT neutro del Jet", 100, 0, 1);
-        hNeutralPTFraction[i]->SetLineColor(i+1);
-        hNeutralPTFraction[i]->SetLineWidth(2);
-
-        // pT promedio de las particulas de cada jet
-        hAveragePT[i] = new TH1F(Form("hAveragePT%d", i), "pT promedio de las particulas del Jet", 100, 0, 60);
-        hAveragePT[i]->SetLineColor(i+1);
-        hAveragePT[i]->SetLineWidth(2);
-
-        // Numero de particulas con pT por debajo del pT promedio por cada jet
-        hParticlesBelowAvgPT[i] = new TH1F(Form("hParticlesBelowAvgPT%d", i), "Numero de particulas con pT < pT promedio del Jet", 120, 0, 120);
-        hParticlesBelowAvgPT[i]->SetLineColor(i+1);
-        hParticlesBelowAvgPT[i]->SetLineWidth(2);
-
-        // Numero de particulas con pT por encima del pT promedio por cada jet
-        hParticlesAboveAvgPT[i] = new TH1F(Form("hParticlesAboveAvgPT%d", i), "Numero de particulas con pT > pT promedio del Jet", 60, 0, 60);
-        hParticlesAboveAvgPT[i]->SetLineColor(i+1);
-        hParticlesAboveAvgPT[i]->SetLineWidth(2);
-
-        // pT(par_max_pT) / pT(j_r)
-        hMaxPTRatio[i] = new TH1F(Form("hMaxPTRatio%d", i), "pT(par_max_pT) / pT(j_r) del Jet", 100, 0, 3.5);
-        hMaxPTRatio[i]->SetLineColor(i+1);
-        hMaxPTRatio[i]->SetLineWidth(2);
-
-        // pT(par_min_pT) / pT(j_r)
-        hMinPTRatio[i] = new TH1F(Form("hMinPTRatio%d", i), "pT(par_min_pT) / pT(j_r) del Jet", 100, 0, 1);
-        hMinPTRatio[i]->SetLineColor(i+1);
-        hMinPTRatio[i]->SetLineWidth(2);
-
-        // pT(par_max_DR) / pT(j_r)
-        hMaxDRRatio[i] = new TH1F(Form("hMaxDRRatio%d", i), "pT(par_max_DR) / pT(j_r) del Jet", 100, 0, 2.5);
-        hMaxDRRatio[i]->SetLineColor(i+1);
-        hMaxDRRatio[i]->SetLineWidth(2);
-
-        // pT(par_min_DR) / pT(j_r)
-        hMinDRRatio[i] = new TH1F(Form("hMinDRRatio%d", i), "pT(par_min_DR) / pT(j_r) del Jet", 100, 0, 2.5);
-        hMinDRRatio[i]->SetLineColor(i+1);
-        hMinDRRatio[i]->SetLineWidth(2);
-
-        // DeltaR(par_max_pT, j_r)
-        hDeltaRMaxPT[i] = new TH1F(Form("hDeltaRMaxPT%d", i), "DeltaR(par_max_pT, j_r) del Jet", 100, 0, 0.4);
-        hDeltaRMaxPT[i]->SetLineColor(i+1);
-        hDeltaRMaxPT[i]->SetLineWidth(2);
-
-        // DeltaR(par_min_pT, j_r)
-        hDeltaRMinPT[i] = new TH1F(Form("hDeltaRMinPT%d", i), "DeltaR(par_min_pT, j_r) del Jet", 100, 0, 0.4);
-        hDeltaRMinPT[i]->SetLineColor(i+1);
-        hDeltaRMinPT[i]->SetLineWidth(2);
-
-        // DeltaR(par_max_DR, j_r)
-        hDeltaRMaxDR[i] = new TH1F(Form("hDeltaRMaxDR%d", i), "DeltaR(par_max_DR, j_r) del Jet", 100, 0, 0.4);
-        hDeltaRMaxDR[i]->SetLineColor(i+1);
-        hDeltaRMaxDR[i]->SetLineWidth(2);
-
-        // DeltaR(par_min_DR, j_r)
-        hDeltaRMinDR[i] = new TH1F(Form("hDeltaRMinDR%d", i), "DeltaR(par_min_DR, j_r) del Jet", 100, 0, 0.4);
-        hDeltaRMinDR[i]->SetLineColor(i+1);
-        hDeltaRMinDR[i]->SetLineWidth(2);
-
-        // pT(par_max_pT) - pT(par_min_pT)
-        hPTDifference[i] = new TH1F(Form("hPTDifference%d", i), "pT(par_max_pT) - pT(par_min_pT) del Jet", 100, 0, 200);
-        hPTDifference[i]->SetLineColor(i+1);
-        hPTDifference[i]->SetLineWidth(2);
-
-        // R al 50% del pT total del jet
-        hR50PercentPT[i] = new TH1F(Form("hR50PercentPT%d", i), "DeltaR para 50% pT total del Jet", 100, 0, 0.4);
-        hR50PercentPT[i]->SetLineColor(i+1);
-        hR50PercentPT[i]->SetLineWidth(2);
-
-        // R al 95% del pT total del jet
-        hR95PercentPT[i] = new TH1F(Form("hR95PercentPT%d", i), "DeltaR para 95% pT total del Jet", 100, 0, 0.4);
-        hR95PercentPT[i]->SetLineColor(i+1);
-        hR95PercentPT[i]->SetLineWidth(2);
-
-        // Histograma 2D de DeltaR vs Porcentaje acumulado de pT
-        hCumulativePT_vs_DeltaR[i] = new TH2F(Form("hCumulativePT_vs_DeltaR%d", i+1),
-                                              Form("DeltaR vs Porcentaje acumulado de pT del Jet %d", i+1),
-                                              25, 0, 0.4,    // Eje X: DeltaR (0 - 0.4)
-                                              25, 0, 1);   // Eje Y: Porcentaje acumulado de pT (0% - 100%)
-        hCumulativePT_vs_DeltaR[i]->SetLineColor(i+1);
-        hCumulativePT_vs_DeltaR[i]->SetLineWidth(2);
-
-        // Histograma 2D de DZTrack vs Porcentaje acumulado de pT
-        hCumulativePT_vs_DZTrack[i] = new TH2F(Form("hCumulativePT_vs_DZTrack%d", i+1),
-                                              Form("DZTrack vs Porcentaje acumulado de pT del Jet %d", i+1),
-                                              25, -4, 4,    // Eje X: DZTrack (-400 - 400)
-                                              25, 0, 1);   // Eje Y: Porcentaje acumulado de pT (0% - 100%)
-        hCumulativePT_vs_DZTrack[i]->SetLineColor(i+1);
-        hCumulativePT_vs_DZTrack[i]->SetLineWidth(2);
-
-        // Histograma 2D de D0Track vs Porcentaje acumulado de pT
-        hCumulativePT_vs_D0Track[i] = new TH2F(Form("hCumulativePT_vs_D0Track%d", i+1),
-                                        Form("D0Track vs Porcentaje acumulado de pT del Jet %d", i+1),
-                                        50, -4, 4,     // Eje X: D0
-                                        50, 0, 1);     // Eje Y: %Porcentaje acumulado de pT
-        hCumulativePT_vs_D0Track[i]->SetLineColor(i+1);
-        hCumulativePT_vs_D0Track[i]->SetLineWidth(2);
-
-        // Histograma 2D de DeltaR vs DZTrack
-        hDeltaR_vs_DZTrack[i] = new TH2F(Form("hDeltaR_vs_DZTrack%d", i+1),
-                                        Form("DeltaR vs DZTrack del Jet %d", i+1),
-                                        25, -4, 4,    // Eje X: DZTrack (-400 - 400)
-                                        25, 0, 0.4);   // Eje Y: DeltaR (0 - 0.4)
-        hDeltaR_vs_DZTrack[i]->SetLineColor(i+1);
-        hDeltaR_vs_DZTrack[i]->SetLineWidth(2);
-
-        // Histograma 2D de DeltaR vs D0Track
-        hDeltaR_vs_D0Track[i] = new TH2F(Form("hDeltaR_vs_D0Track%d", i+1),
-                                    Form("DeltaR vs D0Track del Jet %d", i+1),
-                                    25, -4, 4,     // Eje X: D0
-                                    25, 0, 0.4);   // Eje Y: DeltaR
-        hDeltaR_vs_D0Track[i]->SetLineColor(i+1);
-        hDeltaR_vs_D0Track[i]->SetLineWidth(2);
-
-
-        // pT vs Eta de los jets
-        hPT_vs_Eta[i] = new TH2F(Form("hPT_vs_Eta%d", i), Form("pT vs Eta del Jet %d", i+1),
-                                50, -5.5, 5.5, // Eje X: Eta
-                                50, 0, 100);   // Eje Y: pT
-        hPT_vs_Eta[i]->GetXaxis()->SetTitle("Eta");
-        hPT_vs_Eta[i]->GetYaxis()->SetTitle("pT (GeV)");
-        hPT_vs_Eta[i]->SetLineColor(i+1);
-        hPT_vs_Eta[i]->SetLineWidth(2);
-
-    // Numero de particulas cargadas vs neutras por jet
-        hCharged_vs_NeutralParticles[i] = new TH2F(Form("hCharged_vs_NeutralParticles%d", i),
-                                                Form("Cargadas vs Neutras del Jet %d", i+1),
-                                                15, 0, 15, // Eje X: Cargadas
-                                                15, 0, 15); // Eje Y: Neutras
-        hCharged_vs_NeutralParticles[i]->GetXaxis()->SetTitle("Numero de Particulas Cargadas");
-        hCharged_vs_NeutralParticles[i]->GetYaxis()->SetTitle("Numero de Particulas Neutras");
-        hCharged_vs_NeutralParticles[i]->SetLineColor(i+1);
-        hCharged_vs_NeutralParticles[i]->SetLineWidth(2);
-
-
-    // Fraccion de pT Cargado vs Neutro
-        hChargedPTFraction_vs_NeutralPTFraction[i] = new TH2F(Form("hChargedPTFraction_vs_NeutralPTFraction%d", i),
-                                                                Form("Fraccion de pT Cargado vs Neutro del Jet %d", i+1),
-                                                                10, 0, 1, // Eje X: Fraccion Cargado
-                                                                10, 0, 1); // Eje Y: Fraccion Neutro
-        hChargedPTFraction_vs_NeutralPTFraction[i]->GetXaxis()->SetTitle("Fraccion de pT Cargado");
-        hChargedPTFraction_vs_NeutralPTFraction[i]->GetYaxis()->SetTitle("Fraccion de pT Neutro");
-        hChargedPTFraction_vs_NeutralPTFraction[i]->SetLineColor(i+1);
-        hChargedPTFraction_vs_NeutralPTFraction[i]->SetLineWidth(2);
-
-    // pT Promedio vs Numero Total de Particulas
-        hAveragePT_vs_TotalParticles[i] = new TH2F(Form("hAveragePT_vs_TotalParticles%d", i),
-                                                Form("pT Promedio vs Total Particulas del Jet %d", i+1),
-                                                30, 0, 30, // Eje X: Total Particulas
-                                                40, 0, 20);  // Eje Y: pT Promedio
-        hAveragePT_vs_TotalParticles[i]->GetXaxis()->SetTitle("Numero Total de Particulas");
-        hAveragePT_vs_TotalParticles[i]->GetYaxis()->SetTitle("pT Promedio (GeV)");
-        hAveragePT_vs_TotalParticles[i]->SetLineColor(i+1);
-        hAveragePT_vs_TotalParticles[i]->SetLineWidth(2);
-
-    /* Delta R vs Diferencia en pT entre pares de jets
-        hDeltaR_vs_PTDifference[i] = new TH2F(Form("hDeltaR_vs_PTDifference%d", i),
-                                            Form("DeltaR vs Diferencia en pT para Par %d", i+1),
-                                            50, 0, 10, // Eje X: DeltaR
-                                            100, 0, 200); // Eje Y: Diferencia en pT
-        hDeltaR_vs_PTDifference[i]->GetXaxis()->SetTitle("DeltaR");
-        hDeltaR_vs_PTDifference[i]->GetYaxis()->SetTitle("|pT1 - pT2| (GeV)");
-        hDeltaR_vs_PTDifference[i]->SetLineColor(i+1);
-        hDeltaR_vs_PTDifference[i]->SetLineWidth(2);*/
-
-    // pT(par_max_pT) vs Delta R(par_max_pT, j_r)
-        hMaxPTRatio_vs_DeltaRMaxPT[i] = new TH2F(Form("hMaxPTRatio_vs_DeltaRMaxPT%d", i),
-                                                Form("pT(par_max_pT) / pT(j_r) vs DeltaR(par_max_pT, j_r) del Jet %d", i+1),
-                                                10, 0, 2, // Eje X: pT Ratio
-                                                10, 0, 0.4); // Eje Y: DeltaR
-        hMaxPTRatio_vs_DeltaRMaxPT[i]->GetXaxis()->SetTitle("pT(par_{max}^{PT}) / pT(j_{r})");
-        hMaxPTRatio_vs_DeltaRMaxPT[i]->GetYaxis()->SetTitle("DeltaR(par_{max}^{PT}, j_{r})");
-        hMaxPTRatio_vs_DeltaRMaxPT[i]->SetLineColor(i+1);
-        hMaxPTRatio_vs_DeltaRMaxPT[i]->SetLineWidth(2);
-
-    // R50% vs R95%
-        hR50_vs_R95[i] = new TH2F(Form("hR50_vs_R95%d", i),
-                                Form("R50%% vs R95%% del Jet %d", i+1),
-                                10, 0, 0.4, // Eje X: R50%
-                                10, 0, 0.4); // Eje Y: R95%
-        hR50_vs_R95[i]->GetXaxis()->SetTitle("R50% del pT total");
-        hR50_vs_R95[i]->GetYaxis()->SetTitle("R95% del pT total");
-        hR50_vs_R95[i]->SetLineColor(i+1);
-        hR50_vs_R95[i]->SetLineWidth(2);
+    // Los histogramas no se asocian a gDirectory: cada hilo tiene su propia copia con el mismo nombre
+    TH1::AddDirectory(kFALSE);
 
-    }
+    // Reservar solo los observables activos del registro
+    delete histograms;
+    histograms = new HistogramSet(HistogramRegistry::Default(), fConfig, fLeadingJets);
 
-    // Delta R entre los primeros 4 jets, por parejas
-    for (int i = 0; i < 6; i++) {
-        hDeltaRPar[i] = new TH1F(Form("hDeltaRPar%d", i), "Delta R entre los primeros 4 jets, por parejas", 50, 0, 10);
-        hDeltaRPar[i]->SetLineColor(i+1);
-        hDeltaRPar[i]->SetLineWidth(2);
+    // La exportacion de columnas necesita todas las variables por jet
+    fNeeds = histograms->Needs();
+    if (!fConfig.featureFile.empty()) {
+        fNeeds |= kNeedsTracks | kNeedsProfile | kNeedsLabels;
     }
 }
 
-void JetAnalyzer::LoopEvents() {
+bool JetAnalyzer::LoopEvents(Int_t nThreads) {
+    // Antes de crear cualquier hilo: los de analisis y los lectores de la lectura anticipada
+    // (tambien en modo secuencial) usan ROOT a la vez
+    if (fConfig.readAhead > 0 || nThreads > 1) ROOT::EnableThreadSafety();
+
     std::cout << "Total Entries: " << nentries << std::endl;
-    Long64_t nTen = nentries / 10; // Para imprimir el porcentaje de avance
+    Long64_t nSelected = fLastEntry - fFirstEntry;
+    if (nSelected != nentries) {
+        std::cout << "Entradas seleccionadas: [" << fFirstEntry << ", " << fLastEntry << ")" << std::endl;
+    }
+    HistogramRegistry::Default().CheckConfig(fConfig);
+
+    // Duracion del bucle para el ritmo de eventos y bytes
+    auto loopStart = std::chrono::steady_clock::now();
+    Double_t cpuStart = PhaseTimer::ProcessCpu();
+    auto stopClock = [&]() {
+        fLoopWall = std::chrono::duration<Double_t>(std::chrono::steady_clock::now() - loopStart).count();
+        fLoopCpu = PhaseTimer::ProcessCpu() - cpuStart;
+    };
+
+    // Crear el directorio de las columnas exportadas y el de los puntos de control si no existen
+    if (!fConfig.featureFile.empty() && !MakeParentDirectory(fConfig.featureFile)) return false;
+    if (!MakeDirectory(fConfig.checkpointDir)) return false;
+
+    // Indices de seleccion de ejecuciones anteriores; se guardan los de los archivos sin indice
+    if (!fConfig.selectionCacheDir.empty()) OpenSelectionIndex();
+
+    // Modo secuencial
+    if (nThreads <= 1 || nSelected < nThreads) {
+        LoopRange(fFirstEntry, fLastEntry, true);
+        FinishIoStats();
+        fTimer.Begin(true);
+        bool exported = !columns || JetColumns::Write(fConfig.featureFile, {columns}, fConfig.appendFeatures);
+        SaveSelectionIndex();
+        fTimer.Mark(PhaseTimer::kWrite);
+        stopClock();
+        PrintReadStats();
+        return exported;
+    }
+
+    // Modo paralelo: el TChain se divide en rangos contiguos de entradas y cada hilo
+    // tiene su propio TChain, lector e histogramas. Los TChain de los hilos reciben las
+    // entradas de cada archivo ya contadas por este, y cada hilo se construye con su rango
+    // para que las ramas y el TTreeCache se preparen desde su primera entrada
+    fThreads = nThreads;
+
+    std::vector<JetAnalyzer*> workers;
+    std::vector<std::thread> threads;
+    Long64_t chunk = nSelected / nThreads;
+    Long64_t rest = nSelected % nThreads;
+    Long64_t first = fFirstEntry;
+
+    for (Int_t k = 0; k < nThreads; k++) {
+        Long64_t last = first + chunk + (k < rest ? 1 : 0);
+        AnalyzerConfig range = fConfig;
+        range.firstEntry = first;
+        range.lastEntry = last;
+        JetAnalyzer* worker = new JetAnalyzer(fInputFiles, range, fFileEntries);
+        worker->fIndex = fIndex;
+        worker->fRecordSelection = fRecordSelection;
+        workers.push_back(worker);
+        threads.emplace_back([worker, first, last]() {
+            worker->LoopRange(first, last, false);
+            worker->FinishIoStats();
+        });
+        first = last;
+    }
 
-    for (Long64_t jentry = 0; jentry < nentries; jentry++) {
-        ProcessEvent(jentry);
+    for (auto& thread : threads) {
+        thread.join();
+    }
 
-        // Mostrar progreso
-        if (jentry % nTen == 0)
-            std::cout << 10 * (jentry / nTen) << "%-" << std::flush;
-        if (jentry == nentries - 1)
-            std::cout << "100%" << std::endl;
+    // Combinar los histogramas de cada hilo en el orden de los rangos
+    std::vector<JetColumns*> parts;
+    for (auto* worker : workers) {
+        Merge(*worker);
+        if (worker->columns) parts.push_back(worker->columns);
     }
+
+    // Concatenar las columnas exportadas por cada hilo, en el mismo orden
+    fTimer.Begin(true);
+    bool exported = parts.empty() || JetColumns::Write(fConfig.featureFile, parts, fConfig.appendFeatures);
+    SaveSelectionIndex();
+    fTimer.Mark(PhaseTimer::kWrite);
+
+    for (auto* worker : workers) {
+        delete worker;
+    }
+    std::cout << "100% (" << nThreads << " hilos)" << std::endl;
+    stopClock();
+    PrintReadStats();
+    return exported;
 }
 
-void JetAnalyzer::ProcessEvent(Long64_t entry) {
-    // Cargar el evento
-    Long64_t ientry = t->LoadTree(entry);
-    if (ientry < 0) return;
-    t->fChain->GetEntry(entry);
+void JetAnalyzer::OpenSelectionIndex() {
+    std::string selection = fConfig.preselection.Describe();
+    if (selection.empty()) selection = "preselection=default";
+    if (!fSelection.Open(fConfig.selectionCacheDir, selection, fInputFiles)) return;
+    if (fSelection.Entries() != nentries) {
+        std::cerr << "Aviso: las entradas de los archivos no coinciden con las del TChain; no se usa el indice de seleccion"
+                  << std::endl;
+        return;
+    }
+    fIndex = &fSelection;
+    fRecordSelection = !fSelection.Complete();
+    std::cout << "Indice de seleccion: " << fSelection.Indexed() << " de " << fSelection.Files() << " archivos"
+              << std::endl;
+}
 
-    if (t->Jet_size == 0) return;
+void JetAnalyzer::SaveSelectionIndex() {
+    // Solo si el recorrido ha visto todas las entradas (sin reanudar desde un punto de control)
+    if (!fRecordSelection || !fScanComplete) return;
+    Int_t saved = fSelection.Save(fSelectedEntries, fFirstEntry, fLastEntry);
+    if (saved > 0) std::cout << "Indice de seleccion guardado para " << saved << " archivos" << std::endl;
+}
 
-    // Limpiar vectores
-    jets.clear();
-    particles.clear();
+Long64_t JetAnalyzer::NextEntry(Long64_t entry) const {
+    return fIndex ? fIndex->Next(entry) : entry;
+}
 
-    // Llenar vectores de jets
-    for (Int_t i = 0; i < t->Jet_size; i++) {
-        TLorentzVector jetVector;
-        jetVector.SetPtEtaPhiM(t->Jet_PT[i], t->Jet_Eta[i], t->Jet_Phi[i], t->Jet_Mass[i]);
-        jets.push_back(jetVector);
-    }
+void JetAnalyzer::LoopRange(Long64_t first, Long64_t last, bool showProgress) {
+    Long64_t nTen = std::max<Long64_t>((last - first) / 10, 1); // Para imprimir el porcentaje de avance
 
-    // Llenar vectores de particulas
-    for (Int_t i = 0; i < t->Track_size; i++) {
-        TLorentzVector particleVector;
-        particleVector.SetPtEtaPhiM(t->Track_PT[i], t->Track_Eta[i], t->Track_Phi[i], t->Track_Mass[i]);
-        particles.push_back(particleVector);
+    // Archivo temporal de las columnas exportadas de este rango (al reanudar se conserva)
+    if (!fConfig.featureFile.empty() && !columns) {
+        bool keep = fConfig.resume && !fConfig.checkpointDir.empty();
+        columns = new JetColumns(fConfig.featureFile + ".part" + std::to_string(first), keep);
     }
 
-    // Histograma de jets por evento
-    hJetsPerEvent->Fill(t->Jet_size);
+    // Puntos de control del rango; al reanudar se continua desde el ultimo guardado
+    Checkpoint checkpoint(fConfig, first, last, CheckpointSignature());
+    Long64_t start = first;
+    if (checkpoint.Enabled() && fConfig.resume) start = ResumeRange(checkpoint, first);
 
-    // Procesamiento detallado para cada jet
-    for (Int_t i = 0; i < std::min(4, t->Jet_size); i++) {
-
-        // Histograma de pT, Eta y Phi de los jets
-        hJetPT[i]->Fill(t->Jet_PT[i]);
-        hJetEta[i]->Fill(t->Jet_Eta[i]);
-        hJetPhi[i]->Fill(t->Jet_Phi[i]);
-
-        // Delta R entre los primeros 4 jets, por parejas
-        for (int j = i + 1; j < std::min(4, t->Jet_size); j++) {
-            double deltaR_par = jets[i].DeltaR(jets[j]);
-            int index = i * 3 - (i * (i + 1)) / 2 + j - 1;
-            if (index >= 0 && index < 6) {
-                hDeltaRPar[index]->Fill(deltaR_par);
-            }
+    // Mostrar progreso tras analizar la entrada jentry. Con el indice de seleccion se
+    // saltan entradas: se muestran todas las decenas alcanzadas
+    Int_t tenths = 0; // Decenas de porcentaje mostradas (11: tambien el 100%)
+    auto progress = [&](Long64_t jentry) {
+        if (!showProgress) return;
+        for (; tenths < 10 && jentry - first >= tenths * nTen; tenths++)
+            std::cout << 10 * tenths << "%-" << std::flush;
+        if (jentry == last - 1 && tenths == 10) {
+            std::cout << "100%" << std::endl;
+            tenths++;
         }
-        
-        // Histograma de Numero de particulas cargadas y neutras por jet
-        hChargedParticles[i]->Fill(t->Jet_NCharged[i]);
-        hNeutralsParticles[i]->Fill(t->Jet_NNeutrals[i]);
-
-        // Variables del jet actual
-        TLorentzVector jetVector = jets[i];
-        Double_t jetPT = jetVector.Pt();
-
-        // Inicializacion de variables
-        TLorentzVector chargedPTSum(0, 0, 0, 0);
-        TLorentzVector neutralPTSum(0, 0, 0, 0);
-        Double_t totalPT = 0.0;
-        Double_t sumPT = 0.0;
-        Int_t countParticles = 0;
-
-        TLorentzVector maxPTParticle(0, 0, 0, 0);
-        TLorentzVector minPTParticle(1e9, 0, 0, 0);
-        TLorentzVector maxDRParticle(0, 0, 0, 0);
-        TLorentzVector minDRParticle(0, 0, 0, 0);
-        Double_t maxDR = -1;
-        Double_t minDR = 1e9;
-
-        // Estructura para almacenar informacion de particulas
-        struct ParticleInfo {
-            TLorentzVector vector;
-            Double_t deltaR;
-            Int_t charge;
-            Double_t pt;
-        };
-
-        std::vector<ParticleInfo> particlesInJet;
-
-        // Bucle sobre particulas para el jet actual
-        for (size_t j = 0; j < particles.size(); j++) {
-            const TLorentzVector& particleVector = particles[j];
-            Double_t deltaR = jetVector.DeltaR(particleVector);
-
-            if (deltaR < 0.4) {
-                // Almacenar informacion de la particula
-                particlesInJet.push_back({particleVector, deltaR, t->Track_Charge[j], particleVector.Pt()});
-
-                // Sumar pT y contar particulas
-                sumPT += particleVector.Pt();
-                countParticles++;
-
-                // Actualizar particulas con maximo y minimo pT
-                if (particleVector.Pt() > maxPTParticle.Pt()) {
-                    maxPTParticle = particleVector;
-                }
-                if (particleVector.Pt() < minPTParticle.Pt()) {
-                    minPTParticle = particleVector;
-                }
-
-                // Actualizar particulas con maximo y minimo DeltaR
-                if (deltaR > maxDR) {
-                    maxDR = deltaR;
-                    maxDRParticle = particleVector;
-                }
-                if (deltaR < minDR) {
-                    minDR = deltaR;
-                    minDRParticle = particleVector;
-                }
-
-                // Sumar pT cargado y neutro
-                if (t->Track_Charge[j] != 0) {
-                    chargedPTSum += particleVector;
-                    totalPT += chargedPTSum.Pt();
-                } else {
-                    neutralPTSum += particleVector;
-                    totalPT += neutralPTSum.Pt();
-                }
+    };
+
+    // Tras analizar la entrada jentry: punto de control y progreso
+    auto done = [&](Long64_t jentry) {
+        if (checkpoint.Due()) SaveCheckpoint(checkpoint, jentry + 1);
+        progress(jentry);
+    };
+
+    // Analisis de un lote leido, evento a evento o entero. Por lotes, los histogramas solo
+    // estan al dia al final del lote: el punto de control se guarda entre lotes
+    auto analyze = [&](const EventBatch& batch) {
+        if (!records) {
+            for (Int_t k = 0; k < batch.size; k++) {
+                fTimer.Begin();
+                fBytesRead += batch.bytes[k];
+                fEventsRead++;
+                if (batch.JetCount(k) > 0) SelectEntry(batch.entry[k]);
+                ev = batch.View(k);
+                AnalyzeView();
+                fTimer.End(1);
+                done(batch.entry[k]);
             }
+            return;
+        }
+        for (Int_t k = 0; k < batch.size; k++) {
+            fBytesRead += batch.bytes[k];
+            if (batch.JetCount(k) > 0) SelectEntry(batch.entry[k]);
         }
+        fEventsRead += batch.size;
+        fTimer.Begin();
+        AnalyzeBatch(batch);
+        fTimer.End(batch.size);
+
+        bool due = false;
+        for (Int_t k = 0; k < batch.size; k++) {
+            if (checkpoint.Due()) due = true;
+            progress(batch.entry[k]);
+        }
+        if (due) SaveCheckpoint(checkpoint, batch.entry[batch.size - 1] + 1);
+    };
+
+    if (fConfig.readAhead <= 0 && !records) {
+        // Lectura en el mismo hilo, evento a evento
+        for (Long64_t jentry = NextEntry(start); jentry < last; jentry = NextEntry(jentry + 1)) {
+            ProcessEvent(jentry);
+            done(jentry);
+        }
+    } else if (fConfig.readAhead <= 0) {
+        // Lectura en el mismo hilo, por lotes
+        EventBatch batch(t->MaxJets(), t->MaxTracks());
+        for (Long64_t jentry = start; jentry < last;) {
+            ReadBatch(batch, jentry, last, fTimer);
+            analyze(batch);
+        }
+    } else {
+        // Lectura anticipada: un hilo lector copia lotes de eventos a la cola mientras este
+        // hilo analiza los anteriores. Solo el lector usa el arbol
+        EventRing ring(fConfig.readAhead, t->MaxJets(), t->MaxTracks());
+        PhaseTimer readTimer(fTimer.Enabled());
+        std::thread reader([this, &ring, &readTimer, start, last]() { ReadAhead(ring, start, last, readTimer); });
+
+        while (EventBatch* batch = ring.BeginRead()) {
+            analyze(*batch);
+            ring.EndRead();
+        }
+        reader.join();
+        fPipelineStats.Add(ring.Stats());
+        fTimer.Add(readTimer);
+    }
 
-        Double_t averagePT = (countParticles > 0) ? (sumPT / countParticles) : 0;
+    // Las ultimas entradas del rango pueden haberse saltado con el indice
+    progress(last - 1);
+}
 
-        Double_t maxPTRatio = (jetPT > 0) ? (maxPTParticle.Pt() / jetPT) : 0;
-        Double_t minPTRatio = (jetPT > 0) ? (minPTParticle.Pt() / jetPT) : 0;
-        Double_t maxDRRatio = (jetPT > 0) ? (maxDRParticle.Pt() / jetPT) : 0;
-        Double_t minDRRatio = (jetPT > 0) ? (minDRParticle.Pt() / jetPT) : 0;
+void JetAnalyzer::SelectEntry(Long64_t entry) {
+    fEventsSelected++;
+    if (fRecordSelection) fSelectedEntries.push_back(entry);
+}
 
-        Double_t deltaRMaxPT = jetVector.DeltaR(maxPTParticle);
-        Double_t deltaRMinPT = jetVector.DeltaR(minPTParticle);
-        Double_t deltaRMaxDR = jetVector.DeltaR(maxDRParticle);
-        Double_t deltaRMinDR = jetVector.DeltaR(minDRParticle);
+void JetAnalyzer::ReadBatch(EventBatch& batch, Long64_t& jentry, Long64_t last, PhaseTimer& timer) {
+    // Copia las entradas desde jentry hasta llenar el lote o llegar a last
+    batch.Clear();
+    for (jentry = NextEntry(jentry); jentry < last && batch.size < EventBatch::kEvents; jentry = NextEntry(jentry + 1)) {
+        if (fConfig.ioStats) TrackIoFile(jentry);
+        timer.Begin();
+        Long64_t ientry = t->LoadTree(jentry);
+        timer.Mark(PhaseTimer::kLoad);
+        if (ientry < 0) continue;
+        // Los eventos rechazados por la preseleccion quedan en el lote sin jets ni trazas
+        Int_t nbytes = t->GetJets(ientry);
+        if (!Preselected()) {
+            timer.Mark(PhaseTimer::kDecompress);
+            batch.Skip(jentry, nbytes);
+            continue;
+        }
+        if (fNeeds & kNeedsTracks) nbytes += t->GetTracks(ientry);
+        timer.Mark(PhaseTimer::kDecompress);
+        batch.Add(jentry, nbytes, *t);
+        timer.Mark(PhaseTimer::kVectors);
+    }
+}
 
-        Double_t ptDifference = maxPTParticle.Pt() - minPTParticle.Pt();
+void JetAnalyzer::ReadAhead(EventRing& ring, Long64_t first, Long64_t last, PhaseTimer& timer) {
+    for (Long64_t jentry = first; jentry < last;) {
+        ReadBatch(*ring.BeginWrite(), jentry, last, timer);
+        ring.EndWrite();
+    }
+    ring.Close();
+}
 
-        // Contar particulas por encima y por debajo del pT promedio
-        Int_t particlesBelowAvgPT = 0;
-        Int_t particlesAboveAvgPT = 0;
+Long64_t JetAnalyzer::ResumeRange(Checkpoint& checkpoint, Long64_t first) {
+    Checkpoint::State state;
+    if (!checkpoint.Load(state, *histograms, columns)) {
+        // Sin punto de control valido: el rango empieza de cero
+        if (columns) columns->Restore(0, nullptr);
+        return first;
+    }
+    fBytesRead += state.bytesRead;
+    fEventsRead += state.eventsRead;
+    fEventsSelected += state.eventsSelected;
+    // Las entradas seleccionadas antes del punto de control no se conocen: no se guarda el indice
+    fScanComplete = false;
+    return state.next;
+}
 
-        for (const auto& pInfo : particlesInJet) {
-            if (pInfo.pt < averagePT) {
-                particlesBelowAvgPT++;
-            } else {
-                particlesAboveAvgPT++;
-            }
-        }
+void JetAnalyzer::SaveCheckpoint(Checkpoint& checkpoint, Long64_t next) {
+    fTimer.Begin(true);
+    Checkpoint::State state;
+    state.next = next;
+    state.bytesRead = fBytesRead;
+    state.eventsRead = fEventsRead;
+    state.eventsSelected = fEventsSelected;
+    state.columnRows = columns ? columns->Rows() : 0;
+    checkpoint.Save(state, *histograms, columns);
+    fTimer.Mark(PhaseTimer::kWrite);
+}
 
-        // Llenar histogramas
-        hAveragePT[i]->Fill(averagePT);
-        hParticlesBelowAvgPT[i]->Fill(particlesBelowAvgPT);
-        hParticlesAboveAvgPT[i]->Fill(particlesAboveAvgPT);
-        hMaxPTRatio[i]->Fill(maxPTRatio);
-        hMinPTRatio[i]->Fill(minPTRatio);
-        hMaxDRRatio[i]->Fill(maxDRRatio);
-        hMinDRRatio[i]->Fill(minDRRatio);
-        hDeltaRMaxPT[i]->Fill(deltaRMaxPT);
-        hDeltaRMinPT[i]->Fill(deltaRMinPT);
-        hDeltaRMaxDR[i]->Fill(deltaRMaxDR);
-        hDeltaRMinDR[i]->Fill(deltaRMinDR);
-        hPTDifference[i]->Fill(ptDifference);
-
-        // 1. pT vs Eta
-        hPT_vs_Eta[i]->Fill(t->Jet_Eta[i], t->Jet_PT[i]);
-        //std::cout << "Eta en hPT_vs_Eta" << std::endl;
-
-        // 2. Numero de particulas cargadas vs neutras
-        hCharged_vs_NeutralParticles[i]->Fill(t->Jet_NCharged[i], t->Jet_NNeutrals[i]);
-
-        // 3. Fraccion de pT cargado vs neutro
-
-        // 4. pT Promedio vs Numero Total de Particulas
-        Int_t totalParticles = t->Jet_NCharged[i] + t->Jet_NNeutrals[i];
-        hAveragePT_vs_TotalParticles[i]->Fill(totalParticles, averagePT);
-
-        /* 5. Delta R vs Diferencia en pT entre pares de jets
-        // Este histograma requiere informacion sobre los pares de jets. Puedes llenarlo dentro del bucle que calcula hDeltaRPar
-        // Por ejemplo:
-        for (int j = i + 1; j < std::min(4, t->Jet_size); j++) {
-            double deltaR_par = jets[i].DeltaR(jets[j]);
-            double ptDifference = std::abs(t->Jet_PT[i] - t->Jet_PT[j]);
-            int index = i * 3 - (i * (i + 1)) / 2 + j - 1;
-            if (index >= 0 && index < 6) {
-                hDeltaR_vs_PTDifference[index]->Fill(deltaR_par, ptDifference);
-            }
-        }*/
+std::string JetAnalyzer::CheckpointSignature() const {
+    // Todo lo que cambia el contenido de los histogramas o de las columnas de un rango
+    std::vector<std::string> parts = fInputFiles;
+    parts.push_back("leadingJets=" + std::to_string(fLeadingJets));
+    parts.push_back("featureFile=" + fConfig.featureFile);
+    for (const auto& name : fConfig.observables) parts.push_back("+" + name);
+    for (const auto& name : fConfig.disabledObservables) parts.push_back("-" + name);
+    std::string preselection = fConfig.preselection.Describe();
+    if (!preselection.empty()) parts.push_back(preselection);
+    if (fConfig.flavorSplit) parts.push_back("flavorSplit");
+    return Checkpoint::Signature(parts);
+}
 
-        // 6. pT(par_max_pT) vs Delta R(par_max_pT, j_r)
-        hMaxPTRatio_vs_DeltaRMaxPT[i]->Fill(maxPTRatio, deltaRMaxPT);
+void JetAnalyzer::PrintReadStats() const {
+    // Bytes descomprimidos con las ramas activas; las de trazas solo en los eventos preseleccionados
+    Double_t bytesPerEvent = (fEventsRead > 0) ? (Double_t)fBytesRead / fEventsRead : 0;
+    std::cout << "Bytes leidos: " << fBytesRead << " (" << bytesPerEvent << " bytes/evento)" << std::endl;
+    std::cout << "Eventos preseleccionados: " << fEventsSelected << " de " << fEventsRead << std::endl;
+    if (fIndex) {
+        std::cout << "Entradas saltadas con el indice de seleccion: " << (fLastEntry - fFirstEntry) - fEventsRead
+                  << std::endl;
+    }
+    if (fPipelineStats.batches > 0) {
+        const PipelineStats& p = fPipelineStats;
+        std::cout << "Lectura anticipada: " << p.batches << " lotes, " << p.occupancy / p.batches << " de " << p.depth
+                  << " listos de media; esperas del lector " << p.readerStalls << " (" << p.readerStallSeconds
+                  << " s), del calculo " << p.computeStalls << " (" << p.computeStallSeconds << " s)" << std::endl;
+    }
+    if (fConfig.ioStats) fIo.Print(std::cout);
+#ifdef BTAG_COUNT_ALLOCS
+    std::cout << "Reservas de memoria en ProcessEvent tras el primer evento: " << fSteadyAllocations << std::endl;
+#endif
+}
 
-        // Verificar que sumPT no sea cero para evitar divisiones por cero
-        if (sumPT == 0.0) continue;
+bool JetAnalyzer::CheckSteadyAllocations() const {
+#ifdef BTAG_COUNT_ALLOCS
+    if (fSteadyAllocations > 0) {
+        std::cerr << "Error: " << fSteadyAllocations << " reservas de memoria en el analisis tras el primer evento"
+                  << std::endl;
+        return false;
+    }
+#endif
+    return true;
+}
 
-        // Ordenar particulas por DeltaR
-        std::sort(particlesInJet.begin(), particlesInJet.end(), [](const ParticleInfo& a, const ParticleInfo& b) {
-            return a.deltaR < b.deltaR;
-        });
+void JetAnalyzer::TrackIoFile(Long64_t entry) {
+    if (entry >= fIoBegin && entry < fIoEnd) {
+        fIoEntries++;
+        return;
+    }
 
-        // Calcular el porcentaje acumulado de pT y llenar el histograma 2D
-        Double_t cumulativePT = 0.0;
-        for (const auto& pInfo : particlesInJet) {
-            cumulativePT += pInfo.pt;
-            Double_t cumulativePTFraction = cumulativePT / sumPT;
-            hCumulativePT_vs_DeltaR[i]->Fill(pInfo.deltaR, cumulativePTFraction);
-
-            // llenar el histograma 2D de DZTrack vs Porcentaje acumulado de pT
-            hCumulativePT_vs_DZTrack[i]->Fill(t->Track_DZ[0], cumulativePTFraction);
-            hCumulativePT_vs_D0Track[i]->Fill(t->Track_D0[0], cumulativePTFraction);
-            // Llenar el histograma 2D de DeltaR vs DZTrack
-            hDeltaR_vs_DZTrack[i]->Fill(t->Track_DZ[0], pInfo.deltaR);
-            hDeltaR_vs_D0Track[i]->Fill(t->Track_D0[0], pInfo.deltaR);
-        }
+    // La entrada es de otro archivo: anotar las lecturas del actual antes de que LoadTree lo cierre
+    RecordIoFile();
+    const Long64_t* offsets = t->fChain->GetTreeOffset();
+    Int_t nTrees = t->fChain->GetNtrees();
+    fIoTree = 0;
+    while (fIoTree + 1 < nTrees && offsets[fIoTree + 1] <= entry) {
+        fIoTree++;
+    }
+    fIoBegin = offsets[fIoTree];
+    fIoEnd = offsets[fIoTree + 1];
+    fIoEntries = 1;
+}
 
-        // Calcular R para el 50% y 95% del pT total del jet
-        Double_t aimPT50 = sumPT * 0.5;
-        Double_t aimPT95 = sumPT * 0.95;
-        cumulativePT = 0.0;
-        Double_t r50PercentPT = 0.0;
-        Double_t r95PercentPT = 0.0;
-
-        for (const auto& pInfo : particlesInJet) {
-            cumulativePT += pInfo.pt;
-            if (cumulativePT >= aimPT50 && r50PercentPT == 0.0) {
-                r50PercentPT = pInfo.deltaR;
-            }
-            if (cumulativePT >= aimPT95 && r95PercentPT == 0.0) {
-                r95PercentPT = pInfo.deltaR;
-                break;
-            }
+void JetAnalyzer::RecordIoFile() {
+    if (fIoTree < 0) return;
+    IoReport::File file;
+    file.path = t->fChain->GetListOfFiles()->At(fIoTree)->GetTitle();
+    file.entries = fIoEntries;
+    if (TFile* current = t->fChain->GetCurrentFile()) {
+        file.bytes = current->GetBytesRead();
+        file.readCalls = current->GetReadCalls();
+        if (TTreeCache* cache = t->fChain->GetReadCache(current)) {
+            file.cachedBytes = cache->GetEfficiency() * file.bytes;
+            file.cachedBytesRel = cache->GetEfficiencyRel() * file.bytes;
         }
+    }
+    fIo.AddFile(file);
+    fIoTree = -1;
+    fIoBegin = fIoEnd = 0;
+}
 
-        hR50PercentPT[i]->Fill(r50PercentPT);
-        hR95PercentPT[i]->Fill(r95PercentPT);
+void JetAnalyzer::FinishIoStats() {
+    // Ultimo archivo leido y totales de TTreePerfStats del rango
+    if (!fConfig.ioStats) return;
+    RecordIoFile();
+    fIo.perfReadCalls += fPerfStats->GetReadCalls();
+    fIo.perfBytes += fPerfStats->GetBytesRead();
+    fIo.unzipSeconds += fPerfStats->GetUnzipTime();
+    fIo.diskSeconds += fPerfStats->GetDiskTime();
+}
 
-        // 7. R50% vs R95%
-        hR50_vs_R95[i]->Fill(r50PercentPT, r95PercentPT);
+void JetAnalyzer::Merge(const JetAnalyzer& other) {
+    fBytesRead += other.fBytesRead;
+    fEventsRead += other.fEventsRead;
+    fEventsSelected += other.fEventsSelected;
+    fSelectedEntries.insert(fSelectedEntries.end(), other.fSelectedEntries.begin(), other.fSelectedEntries.end());
+    fScanComplete = fScanComplete && other.fScanComplete;
+    fSteadyAllocations += other.fSteadyAllocations;
+    fPipelineStats.Add(other.fPipelineStats);
+    fTimer.Add(other.fTimer);
+    fIo.Add(other.fIo);
+    histograms->Add(*other.histograms);
+}
 
-        // Calcular fracciones de pT
-        if (totalPT == 0) continue; // Evitar division por cero
+bool JetAnalyzer::Preselected() const {
+    // Preseleccion con las ramas de jets del evento cargado: al menos minJets jets en las ventanas
+    const AnalyzerConfig::Preselection& cut = fConfig.preselection;
+    Int_t needed = std::max(cut.minJets, 1);
+    if (t->Jet_size < needed) return false;
+    Int_t accepted = 0;
+    for (Int_t i = 0; i < t->Jet_size && accepted < needed; i++) {
+        if (cut.AcceptsJet(t->Jet_PT[i], t->Jet_Eta[i])) accepted++;
+    }
+    return accepted >= needed;
+}
 
-        Double_t chargedPTFraction = chargedPTSum.Pt() / totalPT;
-        Double_t neutralPTFraction = neutralPTSum.Pt() / totalPT;
+void JetAnalyzer::ProcessEvent(Long64_t entry) {
+    // Cargar el evento
+    if (fConfig.ioStats) TrackIoFile(entry);
+    fTimer.Begin();
+    Long64_t ientry = t->LoadTree(entry);
+    fTimer.Mark(PhaseTimer::kLoad);
+    if (ientry < 0) return;
+    // Primero las ramas de jets; las de trazas, solo si el evento pasa la preseleccion
+    fBytesRead += t->GetJets(ientry);
+    fEventsRead++;
+    if (!Preselected()) {
+        fTimer.Mark(PhaseTimer::kDecompress);
+        fTimer.End(1);
+        return;
+    }
+    if (fNeeds & kNeedsTracks) fBytesRead += t->GetTracks(ientry);
+    SelectEntry(entry);
+    fTimer.Mark(PhaseTimer::kDecompress);
+
+    ev = EventView::Of(*t);
+    AnalyzeView();
+    fTimer.End(1);
+}
 
-        hChargedPTFraction[i]->Fill(chargedPTFraction);
-        hNeutralPTFraction[i]->Fill(neutralPTFraction);
-        hChargedPTFraction_vs_NeutralPTFraction[i]->Fill(chargedPTFraction, neutralPTFraction);
-    }
+void JetAnalyzer::AnalyzeView() {
+#ifdef BTAG_COUNT_ALLOCS
+    // Reservas de memoria del analisis del evento (sin la lectura del arbol)
+    Long64_t allocations = AllocationCounter::count;
+    AnalyzeEvent();
+    if (fEventsRead > 1) fSteadyAllocations += AllocationCounter::count - allocations;
+#else
+    AnalyzeEvent();
+#endif
 }
 
-void JetAnalyzer::DrawHistograms() {
-    // Configuracion general
-    gStyle->SetOptStat(0); // Desactivar la caja de estadisticas
+void JetAnalyzer::AnalyzeBatch(const EventBatch& batch) {
+#ifdef BTAG_COUNT_ALLOCS
+    // Reservas de memoria del analisis del lote, a partir del segundo
+    Long64_t allocations = AllocationCounter::count;
+    AnalyzeBlock(batch);
+    if (fEventsRead > batch.size) fSteadyAllocations += AllocationCounter::count - allocations;
+#else
+    AnalyzeBlock(batch);
+#endif
+}
 
-    // Histograma de jets por evento
-    TCanvas* cJets = new TCanvas("cJets", "Jets por evento", 600, 400);
-    gPad->SetLogy(); // Escala logaritmica en el eje y
-    hJetsPerEvent->Draw();
-    cJets->SaveAs("plots/JetsPerEvent.png");
-    delete cJets;
-
-    // Histograma de pT de los jets
-    TCanvas* c1 = new TCanvas("c1", "pT de los Jets", 600, 400);
-    gPad->SetLogy();
-    hJetPT[0]->Draw();
-    for (int i = 1; i < 4; i++) {
-        hJetPT[i]->Draw("SAME");
-    }
-    TLegend* legend = new TLegend(0.8, 0.7, 0.9, 0.9);
-    legend->SetHeader("Jets", "C");
-    for (int i = 0; i < 4; i++) {
-        legend->AddEntry(hJetPT[i], Form("Jet %d", i+1), "l");
-    }
-    legend->Draw();
-    c1->SaveAs("plots/PTjets.png");
-    delete legend;
-    delete c1;
-
-    // Histograma de Eta de los jets
-    TCanvas* cEta = new TCanvas("cEta", "Eta de los Jets", 600, 400);
-    gPad->SetLogy();
-    hJetEta[0]->Draw();
-    for (int i = 1; i < 4; i++) {
-        hJetEta[i]->Draw("SAME");
-    }
-    TLegend* legendEta = new TLegend(0.8, 0.7, 0.9, 0.9);
-    legendEta->SetHeader("Jets", "C");
-    for (int i = 0; i < 4; i++) {
-        legendEta->AddEntry(hJetEta[i], Form("Jet %d", i+1), "l");
-    }
-    legendEta->Draw();
-    cEta->SaveAs("plots/Etajets.png");
-    delete legendEta;
-    delete cEta;
-
-    // Histograma de Phi de los jets
-    TCanvas* cPhi = new TCanvas("cPhi", "Phi de los Jets", 600, 400);
-    hJetPhi[0]->Draw();
-    for (int i = 1; i < 4; i++) {
-        hJetPhi[i]->Draw("SAME");
-    }
-    TLegend* legendPhi = new TLegend(0.8, 0.7, 0.9, 0.9);
-    legendPhi->SetHeader("Jets", "C");
-    for (int i = 0; i < 4; i++) {
-        legendPhi->AddEntry(hJetPhi[i], Form("Jet %d", i+1), "l");
-    }
-    legendPhi->Draw();
-    cPhi->SaveAs("plots/Phijets.png");
-    delete legendPhi;
-    delete cPhi;
-
-    // Delta R entre los primeros 4 jets, por parejas
-    TCanvas* cRPar = new TCanvas("cRPar", "R entre las primeras 4 parejas de jets", 600, 400);
-    gPad->SetLogy();
-    hDeltaRPar[0]->Draw();
-    for (int i = 1; i < 6; i++) {
-        hDeltaRPar[i]->Draw("SAME");
-    }
-    TLegend* legendRPar = new TLegend(0.7, 0.55, 0.9, 0.9);
-    legendRPar->SetHeader("DeltaR pares de Jets", "C");
-    legendRPar->AddEntry(hDeltaRPar[0], "Entre 1 y 2", "l");
-    legendRPar->AddEntry(hDeltaRPar[1], "Entre 1 y 3", "l");
-    legendRPar->AddEntry(hDeltaRPar[2], "Entre 1 y 4", "l");
-    legendRPar->AddEntry(hDeltaRPar[3], "Entre 2 y 3", "l");
-    legendRPar->AddEntry(hDeltaRPar[4], "Entre 2 y 4", "l");
-    legendRPar->AddEntry(hDeltaRPar[5], "Entre 3 y 4", "l");
-    legendRPar->Draw();
-    cRPar->SaveAs("plots/RPar.png");
-    delete legendRPar;
-    delete cRPar;
-
-    // Histograma de numero de particulas cargadas por jet
-    TCanvas* cNCharged = new TCanvas("cNCharged", "Numero de particulas cargadas por jet", 600, 400);
-    gPad->SetLogy();
-    hChargedParticles[0]->Draw();
-    for (int i = 1; i < 4; i++) {
-        hChargedParticles[i]->Draw("SAME");
-    }
-    TLegend* legendNCharged = new TLegend(0.8, 0.7, 0.9, 0.9);
-    legendNCharged->SetHeader("Jets", "C");
-    for (int i = 0; i < 4; i++) {
-        legendNCharged->AddEntry(hChargedParticles[i], Form("Jet %d", i+1), "l");
-    }
-    legendNCharged->Draw();
-    cNCharged->SaveAs("plots/NCharged.png");
-    delete legendNCharged;
-    delete cNCharged;
-
-    // Histograma de numero de particulas neutras por jet
-    TCanvas* cNNeutrals = new TCanvas("cNNeutrals", "Numero de particulas neutras por jet", 600, 400);
-    gPad->SetLogy();
-    hNeutralsParticles[0]->Draw();
-    for (int i = 1; i < 4; i++) {
-        hNeutralsParticles[i]->Draw("SAME");
-    }
-    TLegend* legendNNeutrals = new TLegend(0.8, 0.7, 0.9, 0.9);
-    legendNNeutrals->SetHeader("Jets", "C");
-    for (int i = 0; i < 4; i++) {
-        legendNNeutrals->AddEntry(hNeutralsParticles[i], Form("Jet %d", i+1), "l");
-    }
-    legendNNeutrals->Draw();
-    cNNeutrals->SaveAs("plots/NNeutrals.png");
-    delete legendNNeutrals;
-    delete cNNeutrals;
-
-    // Histograma de fraccion de pT cargado del jet
-    TCanvas* cChargedPTFraction = new TCanvas("cChargedPTFraction", "Fraccion de pT cargado del Jet", 600, 400);
-    gPad->SetLogy();
-    hChargedPTFraction[0]->Draw();
-    for (int i = 1; i < 4; i++) {
-        hChargedPTFraction[i]->Draw("SAME");
-    }
-    TLegend* legendChargedPTFraction = new TLegend(0.8, 0.7, 0.9, 0.9);
-    legendChargedPTFraction->SetHeader("Jets", "C");
-    for (int i = 0; i < 4; i++) {
-        legendChargedPTFraction->AddEntry(hChargedPTFraction[i], Form("Jet %d", i+1), "l");
-    }
-    legendChargedPTFraction->Draw();
-    cChargedPTFraction->SaveAs("plots/ChargedPTFraction.png");
-    delete legendChargedPTFraction;
-    delete cChargedPTFraction;
-
-    // Histograma de fraccion de pT neutro del jet
-    TCanvas* cNeutralPTFraction = new TCanvas("cNeutralPTFraction", "Fraccion de pT neutro del Jet", 600, 400);
-    gPad->SetLogy();
-    hNeutralPTFraction[0]->Draw();
-    for (int i = 1; i < 4; i++) {
-        hNeutralPTFraction[i]->Draw("SAME");
-    }
-    TLegend* legendNeutralPTFraction = new TLegend(0.1, 0.7, 0.2, 0.9);
-    legendNeutralPTFraction->SetHeader("Jets", "C");
-    for (int i = 0; i < 4; i++) {
-        legendNeutralPTFraction->AddEntry(hNeutralPTFraction[i], Form("Jet %d", i+1), "l");
-    }
-    legendNeutralPTFraction->Draw();
-    cNeutralPTFraction->SaveAs("plots/NeutralPTFraction.png");
-    delete legendNeutralPTFraction;
-    delete cNeutralPTFraction;
-
-    // Histograma de pT promedio de las particulas del jet
-    TCanvas* cAveragePT = new TCanvas("cAveragePT", "pT promedio de las particulas del Jet", 600, 400);
-    gPad->SetLogy();
-    hAveragePT[0]->Draw();
-    for (int i = 1; i < 4; i++) {
-        hAveragePT[i]->Draw("SAME");
-    }
-    TLegend* legendAveragePT = new TLegend(0.8, 0.7, 0.9, 0.9);
-    legendAveragePT->SetHeader("Jets", "C");
-    for (int i = 0; i < 4; i++) {
-        legendAveragePT->AddEntry(hAveragePT[i], Form("Jet %d", i+1), "l");
-    }
-    legendAveragePT->Draw();
-    cAveragePT->SaveAs("plots/AveragePT.png");
-    delete legendAveragePT;
-    delete cAveragePT;
-
-    // Histograma de numero de particulas con pT por debajo del promedio
-    TCanvas* cParticlesBelowAvgPT = new TCanvas("cParticlesBelowAvgPT", "Numero de particulas con pT < pT promedio del Jet", 600, 400);
-    gPad->SetLogy();
-    hParticlesBelowAvgPT[0]->Draw();
-    for (int i = 1; i < 4; i++) {
-        hParticlesBelowAvgPT[i]->Draw("SAME");
-    }
-    TLegend* legendParticlesBelowAvgPT = new TLegend(0.8, 0.7, 0.9, 0.9);
-    legendParticlesBelowAvgPT->SetHeader("Jets", "C");
-    for (int i = 0; i < 4; i++) {
-        legendParticlesBelowAvgPT->AddEntry(hParticlesBelowAvgPT[i], Form("Jet %d", i+1), "l");
-    }
-    legendParticlesBelowAvgPT->Draw();
-    cParticlesBelowAvgPT->SaveAs("plots/ParticlesBelowAvgPT.png");
-    delete legendParticlesBelowAvgPT;
-    delete cParticlesBelowAvgPT;
-
-    // Histograma de numero de particulas con pT por encima del promedio
-    TCanvas* cParticlesAboveAvgPT = new TCanvas("cParticlesAboveAvgPT", "Numero de particulas con pT > pT promedio del Jet", 600, 400);
-    gPad->SetLogy();
-    hParticlesAboveAvgPT[0]->Draw();
-    for (int i = 1; i < 4; i++) {
-        hParticlesAboveAvgPT[i]->Draw("SAME");
-    }
-    TLegend* legendParticlesAboveAvgPT = new TLegend(0.8, 0.7, 0.9, 0.9);
-    legendParticlesAboveAvgPT->SetHeader("Jets", "C");
-    for (int i = 0; i < 4; i++) {
-        legendParticlesAboveAvgPT->AddEntry(hParticlesAboveAvgPT[i], Form("Jet %d", i+1), "l");
-    }
-    legendParticlesAboveAvgPT->Draw();
-    cParticlesAboveAvgPT->SaveAs("plots/ParticlesAboveAvgPT.png");
-    delete legendParticlesAboveAvgPT;
-    delete cParticlesAboveAvgPT;
-
-    // Histograma de pT(par_max_pT) / pT(j_r)
-    TCanvas* cMaxPTRatio = new TCanvas("cMaxPTRatio", "pT(par_max_pT) / pT(j_r) del Jet", 600, 400);
-    gPad->SetLogy();
-    hMaxPTRatio[0]->Draw();
-    for (int i = 1; i < 4; i++) {
-        hMaxPTRatio[i]->Draw("SAME");
-    }
-    TLegend* legendMaxPTRatio = new TLegend(0.8, 0.7, 0.9, 0.9);
-    legendMaxPTRatio->SetHeader("Jets", "C");
-    for (int i = 0; i < 4; i++) {
-        legendMaxPTRatio->AddEntry(hMaxPTRatio[i], Form("Jet %d", i+1), "l");
-    }
-    legendMaxPTRatio->Draw();
-    cMaxPTRatio->SaveAs("plots/MaxPTRatio.png");
-    delete legendMaxPTRatio;
-    delete cMaxPTRatio;
-
-    // Histograma de pT(par_min_pT) / pT(j_r)
-    TCanvas* cMinPTRatio = new TCanvas("cMinPTRatio", "pT(par_min_pT) / pT(j_r) del Jet", 600, 400);
-    gPad->SetLogy();
-    hMinPTRatio[0]->Draw();
-    for (int i = 1; i < 4; i++) {
-        hMinPTRatio[i]->Draw("SAME");
-    }
-    TLegend* legendMinPTRatio = new TLegend(0.8, 0.7, 0.9, 0.9);
-    legendMinPTRatio->SetHeader("Jets", "C");
-    for (int i = 0; i < 4; i++) {
-        legendMinPTRatio->AddEntry(hMinPTRatio[i], Form("Jet %d", i+1), "l");
-    }
-    legendMinPTRatio->Draw();
-    cMinPTRatio->SaveAs("plots/MinPTRatio.png");
-    delete legendMinPTRatio;
-    delete cMinPTRatio;
-
-    // Histograma de pT(par_max_DR) / pT(j_r)
-    TCanvas* cMaxDRRatio = new TCanvas("cMaxDRRatio", "pT(par_max_DR) / pT(j_r) del Jet", 600, 400);
-    gPad->SetLogy();
-    hMaxDRRatio[0]->Draw();
-    for (int i = 1; i < 4; i++) {
-        hMaxDRRatio[i]->Draw("SAME");
-    }
-    TLegend* legendMaxDRRatio = new TLegend(0.8, 0.7, 0.9, 0.9);
-    legendMaxDRRatio->SetHeader("Jets", "C");
-    for (int i = 0; i < 4; i++) {
-        legendMaxDRRatio->AddEntry(hMaxDRRatio[i], Form("Jet %d", i+1), "l");
-    }
-    legendMaxDRRatio->Draw();
-    cMaxDRRatio->SaveAs("plots/MaxDRRatio.png");
-    delete legendMaxDRRatio;
-    delete cMaxDRRatio;
-
-    // Histograma de pT(par_min_DR) / pT(j_r)
-    TCanvas* cMinDRRatio = new TCanvas("cMinDRRatio", "pT(par_min_DR) / pT(j_r) del Jet", 600, 400);
-    gPad->SetLogy();
-    hMinDRRatio[0]->Draw();
-    for (int i = 1; i < 4; i++) {
-        hMinDRRatio[i]->Draw("SAME");
-    }
-    TLegend* legendMinDRRatio = new TLegend(0.8, 0.7, 0.9, 0.9);
-    legendMinDRRatio->SetHeader("Jets", "C");
-    for (int i = 0; i < 4; i++) {
-        legendMinDRRatio->AddEntry(hMinDRRatio[i], Form("Jet %d", i+1), "l");
-    }
-    legendMinDRRatio->Draw();
-    cMinDRRatio->SaveAs("plots/MinDRRatio.png");
-    delete legendMinDRRatio;
-    delete cMinDRRatio;
-
-    // Histograma de DeltaR(par_max_pT, j_r)
-    TCanvas* cDeltaRMaxPT = new TCanvas("cDeltaRMaxPT", "DeltaR(par_max_pT, j_r) del Jet", 600, 400);
-    gPad->SetLogy();
-    hDeltaRMaxPT[0]->Draw();
-    for (int i = 1; i < 4; i++) {
-        hDeltaRMaxPT[i]->Draw("SAME");
-    }
-    TLegend* legendDeltaRMaxPT = new TLegend(0.8, 0.7, 0.9, 0.9);
-    legendDeltaRMaxPT->SetHeader("Jets", "C");
-    for (int i = 0; i < 4; i++) {
-        legendDeltaRMaxPT->AddEntry(hDeltaRMaxPT[i], Form("Jet %d", i+1), "l");
-    }
-    legendDeltaRMaxPT->Draw();
-    cDeltaRMaxPT->SaveAs("plots/DeltaRMaxPT.png");
-    delete legendDeltaRMaxPT;
-    delete cDeltaRMaxPT;
-
-    // Histograma de DeltaR(par_min_pT, j_r)
-    TCanvas* cDeltaRMinPT = new TCanvas("cDeltaRMinPT", "DeltaR(par_min_pT, j_r) del Jet", 600, 400);
-    gPad->SetLogy();
-    hDeltaRMinPT[0]->Draw();
-    for (int i = 1; i < 4; i++) {
-        hDeltaRMinPT[i]->Draw("SAME");
-    }
-    TLegend* legendDeltaRMinPT = new TLegend(0.1, 0.7, 0.2, 0.9);
-    legendDeltaRMinPT->SetHeader("Jets", "C");
-    for (int i = 0; i < 4; i++) {
-        legendDeltaRMinPT->AddEntry(hDeltaRMinPT[i], Form("Jet %d", i+1), "l");
-    }
-    legendDeltaRMinPT->Draw();
-    cDeltaRMinPT->SaveAs("plots/DeltaRMinPT.png");
-    delete legendDeltaRMinPT;
-    delete cDeltaRMinPT;
-
-    // Histograma de DeltaR(par_max_DR, j_r)
-    TCanvas* cDeltaRMaxDR = new TCanvas("cDeltaRMaxDR", "DeltaR(par_max_DR, j_r) del Jet", 600, 400);
-    gPad->SetLogy();
-    hDeltaRMaxDR[0]->Draw();
-    for (int i = 1; i < 4; i++) {
-        hDeltaRMaxDR[i]->Draw("SAME");
-    }
-    TLegend* legendDeltaRMaxDR = new TLegend(0.1, 0.7, 0.2, 0.9);
-    legendDeltaRMaxDR->SetHeader("Jets", "C");
-    for (int i = 0; i < 4; i++) {
-        legendDeltaRMaxDR->AddEntry(hDeltaRMaxDR[i], Form("Jet %d", i+1), "l");
-    }
-    legendDeltaRMaxDR->Draw();
-    cDeltaRMaxDR->SaveAs("plots/DeltaRMaxDR.png");
-    delete legendDeltaRMaxDR;
-    delete cDeltaRMaxDR;
-
-    // Histograma de DeltaR(par_min_DR, j_r)
-    TCanvas* cDeltaRMinDR = new TCanvas("cDeltaRMinDR", "DeltaR(par_min_DR, j_r) del Jet", 600, 400);
-    gPad->SetLogy();
-    hDeltaRMinDR[0]->Draw();
-    for (int i = 1; i < 4; i++) {
-        hDeltaRMinDR[i]->Draw("SAME");
-    }
-    TLegend* legendDeltaRMinDR = new TLegend(0.8, 0.7, 0.9, 0.9);
-    legendDeltaRMinDR->SetHeader("Jets", "C");
-    for (int i = 0; i < 4; i++) {
-        legendDeltaRMinDR->AddEntry(hDeltaRMinDR[i], Form("Jet %d", i+1), "l");
-    }
-    legendDeltaRMinDR->Draw();
-    cDeltaRMinDR->SaveAs("plots/DeltaRMinDR.png");
-    delete legendDeltaRMinDR;
-    delete cDeltaRMinDR;
-
-    // Histograma de pT(par_max_pT) - pT(par_min_pT)
-    TCanvas* cPTDifference = new TCanvas("cPTDifference", "pT(par_max_pT) - pT(par_min_pT) del Jet", 600, 400);
-    gPad->SetLogy();
-    hPTDifference[0]->Draw();
-    for (int i = 1; i < 4; i++) {
-        hPTDifference[i]->Draw("SAME");
+void JetAnalyzer::AnalyzeBlock(const EventBatch& batch) {
+    // Los mismos calculos que AnalyzeEvent, cada uno sobre todos los eventos del lote; los
+    // registros de cada jet principal quedan en records en el orden de los eventos
+    UInt_t needs = fNeeds;
+    records->Clear();
+
+    // Jets por evento (eventos con jets)
+    for (Int_t k = 0; k < batch.size; k++) {
+        Int_t nJets = batch.JetCount(k);
+        if (nJets > 0) records->events.push_back({nJets});
+    }
+
+    // Delta R entre los jets principales, por parejas
+    if (needs & kNeedsPairs) {
+        for (Int_t k = 0; k < batch.size; k++) {
+            Int_t nLeading = std::min(fLeadingJets, batch.JetCount(k));
+            if (nLeading == 0) continue;
+            ev = batch.View(k);
+            switch (nLeading) {
+                case 2: FillPairs<2>(nLeading); break;
+                case 4: FillPairs<4>(nLeading); break;
+                case 8: FillPairs<8>(nLeading); break;
+                default: FillPairs<0>(nLeading); break;
+            }
+        }
     }
-    TLegend* legendPTDifference = new TLegend(0.8, 0.7, 0.9, 0.9);
-    legendPTDifference->SetHeader("Jets", "C");
-    for (int i = 0; i < 4; i++) {
-        legendPTDifference->AddEntry(hPTDifference[i], Form("Jet %d", i+1), "l");
+
+    // Cinematica y etiquetas de los jets principales, de las columnas del lote
+    const bool labels = needs & kNeedsLabels;
+    for (Int_t k = 0; k < batch.size; k++) {
+        Int_t first = batch.jetOffset[k];
+        Int_t nLeading = std::min(fLeadingJets, batch.JetCount(k));
+        for (Int_t i = 0; i < nLeading; i++) {
+            records->jets[i].emplace_back();
+            JetFeatures& f = records->jets[i].back();
+            f.index = i;
+            f.pt = batch.jetPT[first + i];
+            f.eta = batch.jetEta[first + i];
+            f.phi = batch.jetPhi[first + i];
+            f.nCharged = batch.jetNCharged[first + i];
+            f.nNeutrals = batch.jetNNeutrals[first + i];
+            if (labels) {
+                f.flavor = batch.jetFlavor[first + i];
+                f.btag = batch.jetBTag[first + i];
+                f.category = FlavorCategoryOf(f.flavor);
+            }
+        }
     }
-    legendPTDifference->Draw();
-    cPTDifference->SaveAs("plots/PTDifference.png");
-    delete legendPTDifference;
-    delete cPTDifference;
-
-    // Histograma de R al 50% del pT total del jet
-    TCanvas* cR50 = new TCanvas("cR50", "R al 50% del pT total del jet", 600, 400);
-    gPad->SetLogy();
-    hR50PercentPT[0]->Draw();
-    for (int i = 1; i < 4; i++) {
-        hR50PercentPT[i]->Draw("SAME");
+    fTimer.Mark(PhaseTimer::kVectors);
+
+    // Trazas y perfil radial, evento a evento: la asignacion de trazas usa la memoria del
+    // evento. row[i]: registro del jet i del evento actual
+    Int_t row[kMaxLeadingJets] = {};
+    if (needs & kNeedsTracks) {
+        for (Int_t k = 0; k < batch.size; k++) {
+            Int_t nLeading = std::min(fLeadingJets, batch.JetCount(k));
+            if (nLeading == 0) continue;
+            ev = batch.View(k);
+            MatchTracks(nLeading);
+            for (Int_t i = 0; i < nLeading; i++) {
+                JetFeatures& f = records->jets[i][row[i]++];
+                ComputeTrackFeatures(i, f);
+                fTimer.Mark(PhaseTimer::kMatching);
+                if ((needs & kNeedsProfile) && f.sumPT != 0.0) ComputeRadialProfile(i, f);
+                fTimer.Mark(PhaseTimer::kProfile);
+            }
+        }
     }
-    TLegend* legendR50 = new TLegend(0.8, 0.7, 0.9, 0.9);
-    legendR50->SetHeader("Jets", "C");
-    for (int i = 0; i < 4; i++) {
-        legendR50->AddEntry(hR50PercentPT[i], Form("Jet %d", i+1), "l");
+
+    histograms->Fill(*records);
+
+    // Columnas exportadas: los jets principales de cada evento, en orden
+    if (columns) {
+        std::fill_n(row, fLeadingJets, 0);
+        for (Int_t k = 0; k < batch.size; k++) {
+            Int_t nLeading = std::min(fLeadingJets, batch.JetCount(k));
+            for (Int_t i = 0; i < nLeading; i++) {
+                columns->Add(records->jets[i][row[i]++]);
+            }
+        }
     }
-    legendR50->Draw();
-    cR50->SaveAs("plots/R50.png");
-    delete legendR50;
-    delete cR50;
-
-    // Histograma de R al 95% del pT total del jet
-    TCanvas* cR95 = new TCanvas("cR95", "R al 95% del pT total del jet", 600, 400);
-    gPad->SetLogy();
-    hR95PercentPT[0]->Draw();
-    for (int i = 1; i < 4; i++) {
-        hR95PercentPT[i]->Draw("SAME");
+    fTimer.Mark(PhaseTimer::kFill);
+}
+
+void JetAnalyzer::StorePair(Int_t pair, const PairFeatures& f) {
+    // Al histograma o, por lotes, a los registros del lote
+    if (records) {
+        records->pairs[pair].push_back(f);
+    } else {
+        histograms->FillPair(pair, f);
     }
-    TLegend* legendR95 = new TLegend(0.1, 0.7, 0.2, 0.9);
-    legendR95->SetHeader("Jets", "C");
-    for (int i = 0; i < 4; i++) {
-        legendR95->AddEntry(hR95PercentPT[i], Form("Jet %d", i+1), "l");
+}
+
+void JetAnalyzer::StorePoint(Int_t jet, const RadialPoint& f) {
+    if (!records) {
+        histograms->FillPoint(jet, f);
+        return;
     }
-    legendR95->Draw();
-    cR95->SaveAs("plots/R95.png");
-    delete legendR95;
-    delete cR95;
-
-    // Dibujar y guardar histogramas 2D de DeltaR vs Porcentaje acumulado de pT
-    for (int i = 0; i < 4; i++) {
-        TCanvas* cCumulativePT_vs_DeltaR = new TCanvas(Form("cCumulativePT_vs_DeltaR%d", i+1),
-                                                       Form("Porcentaje acumulado de pT vs DeltaR del Jet %d", i+1),
-                                                       600, 400);
-        gStyle->SetNumberContours(10); // Numero de colores a utilizar
-        gPad->SetLogz(); // Escala logaritmica en el eje z
-        hCumulativePT_vs_DeltaR[i]->GetXaxis()->SetTitle("#DeltaR");
-        hCumulativePT_vs_DeltaR[i]->GetYaxis()->SetTitle("Porcentaje acumulado de pT");
-        hCumulativePT_vs_DeltaR[i]->Draw("SURF2");
-        cCumulativePT_vs_DeltaR->SaveAs(Form("plots/CumulativePT_vs_DeltaR_Jet%d.png", i+1));
-        hCumulativePT_vs_DeltaR[i]->Draw("CONT1");
-        cCumulativePT_vs_DeltaR->SaveAs(Form("plots/CONT_CumulativePT_vs_DeltaR_Jet%d.png", i+1));
-        delete cCumulativePT_vs_DeltaR;
+    // Sin sitio en el lote: se llenan los puntos acumulados del jet
+    if (records->PointsFull(jet)) {
+        histograms->FillPoints(jet, records->points[jet]);
+        records->points[jet].clear();
     }
+    records->points[jet].push_back(f);
+}
 
-    // Dibujar y guardar histogramas 2D de DZTrack vs Porcentaje acumulado de pT
-    for (int i = 0; i < 4; i++) {
-        TCanvas* cCumulativePT_vs_DZTrack = new TCanvas(Form("cCumulativePT_vs_DZTrack%d", i+1),
-                                                       Form("Porcentaje acumulado de pT vs DZTrack del Jet %d", i+1),
-                                                       600, 400);
-        gStyle->SetNumberContours(10); // Numero de colores a utilizar
-        gPad->SetLogz(); // Escala logaritmica en el eje z
-        hCumulativePT_vs_DZTrack[i]->GetXaxis()->SetTitle("DZTrack");
-        hCumulativePT_vs_DZTrack[i]->GetYaxis()->SetTitle("Porcentaje acumulado de pT");
-        hCumulativePT_vs_DZTrack[i]->Draw("SURF2");
-        cCumulativePT_vs_DZTrack->SaveAs(Form("plots/CumulativePT_vs_DZTrack_Jet%d.png", i+1));
-        hCumulativePT_vs_DZTrack[i]->Draw("CONT1");
-        cCumulativePT_vs_DZTrack->SaveAs(Form("plots/CONT_CumulativePT_vs_DZTrack_Jet%d.png", i+1));
-        delete cCumulativePT_vs_DZTrack;
-    }
+void JetAnalyzer::AnalyzeEvent() {
+    if (ev.Jet_size == 0) return;
 
-    // Dibujar y guardar histogramas 2D de D0Track vs Porcentaje acumulado de pT
-    for (int i = 0; i < 4; i++) {
-        TCanvas* cCumulativePT_vs_D0Track = new TCanvas(Form("cCumulativePT_vs_D0Track%d", i+1),
-                                                       Form("Porcentaje acumulado de pT vs D0Track del Jet %d", i+1),
-                                                       600, 400);
-        gStyle->SetNumberContours(10); // Numero de colores a utilizar
-        gPad->SetLogz(); // Escala logaritmica en el eje z
-        hCumulativePT_vs_D0Track[i]->GetXaxis()->SetTitle("D0Track");
-        hCumulativePT_vs_D0Track[i]->GetYaxis()->SetTitle("Porcentaje acumulado de pT");
-        hCumulativePT_vs_D0Track[i]->Draw("SURF2");
-        cCumulativePT_vs_D0Track->SaveAs(Form("plots/CumulativePT_vs_D0Track_Jet%d.png", i+1));
-        hCumulativePT_vs_D0Track[i]->Draw("CONT1");
-        cCumulativePT_vs_D0Track->SaveAs(Form("plots/CONT_CumulativePT_vs_D0Track_Jet%d.png", i+1));
-        delete cCumulativePT_vs_D0Track;
-    }
+    // Grupos de variables que piden los observables activos y la exportacion
+    UInt_t needs = fNeeds;
 
-    // Dibujar y guardar histogramas 2D de DZTrack vs DeltaR
-    for (int i = 0; i < 4; i++) {
-        TCanvas* cDeltaR_vs_DZTrack = new TCanvas(Form("chDeltaR_vs_DZTrack%d", i+1),
-                                                 Form("DeltaR vs DZTrack del Jet %d", i+1),
-                                                 600, 400);
-        gStyle->SetNumberContours(10); // Numero de colores a utilizar
-        gPad->SetLogz(); // Escala logaritmica en el eje z
-        hDeltaR_vs_DZTrack[i]->GetXaxis()->SetTitle("DZTrack");
-        hDeltaR_vs_DZTrack[i]->GetYaxis()->SetTitle("#DeltaR");
-        hDeltaR_vs_DZTrack[i]->Draw("SURF2");
-        cDeltaR_vs_DZTrack->SaveAs(Form("plots/hDeltaR_vs_DZTrack_Jet%d.png", i+1));
-        hDeltaR_vs_DZTrack[i]->Draw("CONT1");
-        cDeltaR_vs_DZTrack->SaveAs(Form("plots/CONT_hDeltaR_vs_DZTrack_Jet%d.png", i+1));
-        delete cDeltaR_vs_DZTrack;
+    // Histograma de jets por evento
+    EventFeatures event;
+    event.nJets = ev.Jet_size;
+    histograms->FillEvent(event);
+    fTimer.Mark(PhaseTimer::kFill);
+
+    Int_t nLeading = std::min(fLeadingJets, ev.Jet_size);
+
+    // Delta R entre los jets principales, por parejas. Los casos comunes usan un
+    // numero de jets fijo en compilacion (bucles desenrollados)
+    if (needs & kNeedsPairs) {
+        switch (nLeading) {
+            case 2: FillPairs<2>(nLeading); break;
+            case 4: FillPairs<4>(nLeading); break;
+            case 8: FillPairs<8>(nLeading); break;
+            default: FillPairs<0>(nLeading); break;
+        }
+        fTimer.Mark(PhaseTimer::kVectors);
     }
 
-        // Dibujar y guardar histogramas 2D de D0Track vs DeltaR
-    for (int i = 0; i < 4; i++) {
-        TCanvas* cDeltaR_vs_D0Track = new TCanvas(Form("chDeltaR_vs_D0Track%d", i+1),
-                                                 Form("DeltaR vs D0Track del Jet %d", i+1),
-                                                 600, 400);
-        gStyle->SetNumberContours(10); // Numero de colores a utilizar
-        gPad->SetLogz(); // Escala logaritmica en el eje z
-        hDeltaR_vs_D0Track[i]->GetXaxis()->SetTitle("D0Track");
-        hDeltaR_vs_D0Track[i]->GetYaxis()->SetTitle("#DeltaR");
-        hDeltaR_vs_D0Track[i]->Draw("SURF2");
-        cDeltaR_vs_D0Track->SaveAs(Form("plots/hDeltaR_vs_D0Track_Jet%d.png", i+1));
-        hDeltaR_vs_D0Track[i]->Draw("CONT1");
-        cDeltaR_vs_D0Track->SaveAs(Form("plots/CONT_hDeltaR_vs_D0Track_Jet%d.png", i+1));
-        delete cDeltaR_vs_D0Track;
-    }
+    // Asignar las trazas del evento a los conos de los jets principales
+    if (needs & kNeedsTracks) MatchTracks(nLeading);
+
+    // Procesamiento detallado para cada jet
+    for (Int_t i = 0; i < nLeading; i++) {
+        JetFeatures f = {};
+        f.index = i;
+
+        // Cinematica y numero de particulas cargadas y neutras del jet
+        f.pt = ev.Jet_PT[i];
+        f.eta = ev.Jet_Eta[i];
+        f.phi = ev.Jet_Phi[i];
+        f.nCharged = ev.Jet_NCharged[i];
+        f.nNeutrals = ev.Jet_NNeutrals[i];
+
+        if (needs & kNeedsLabels) {
+            f.flavor = ev.Jet_Flavor[i];
+            f.btag = ev.Jet_BTag[i];
+            f.category = FlavorCategoryOf(f.flavor);
+        }
 
-    // pT vs Eta de los jets
-    for (int i = 0; i < 4; i++) {
-        TCanvas* cPT_vs_Eta = new TCanvas(Form("cPT_vs_Eta%d", i), Form("pT vs Eta del Jet %d", i+1), 800, 600);
-        gStyle->SetNumberContours(10); // Numero de colores a utilizar
-        gPad->SetLogz(); // Escala logaritmica en el eje z
-        hPT_vs_Eta[i]->GetXaxis()->SetTitle("Eta");
-        hPT_vs_Eta[i]->GetYaxis()->SetTitle("pT (GeV)");
-        hPT_vs_Eta[i]->Draw("COLZ");
-        cPT_vs_Eta->SaveAs(Form("plots/PT_vs_Eta_Jet%d.png", i+1));
-        delete cPT_vs_Eta;
+        if (needs & kNeedsTracks) ComputeTrackFeatures(i, f);
+        fTimer.Mark(PhaseTimer::kMatching);
+
+        // Verificar que sumPT no sea cero para evitar divisiones por cero
+        if ((needs & kNeedsProfile) && f.sumPT != 0.0) ComputeRadialProfile(i, f);
+        fTimer.Mark(PhaseTimer::kProfile);
+
+        histograms->FillJet(i, f);
+        if (columns) columns->Add(f);
+        fTimer.Mark(PhaseTimer::kFill);
     }
+}
+
+template <Int_t N>
+void JetAnalyzer::FillPairs(Int_t nLeading) {
+    // N > 0: numero de jets conocido en compilacion; N = 0: nLeading
+    const Int_t n = (N > 0) ? N : nLeading;
 
-    // Numero de particulas cargadas vs neutras por jet
-    for (int i = 0; i < 4; i++) {
-        TCanvas* cCharged_vs_Neutral = new TCanvas(Form("cCharged_vs_Neutral%d", i), Form("Cargadas vs Neutras del Jet %d", i+1), 800, 600);
-        gStyle->SetNumberContours(10); // Numero de colores a utilizar
-        gPad->SetLogz(); // Escala logaritmica en el eje z
-        hCharged_vs_NeutralParticles[i]->GetXaxis()->SetTitle("Numero de Particulas Cargadas");
-        hCharged_vs_NeutralParticles[i]->GetYaxis()->SetTitle("Numero de Particulas Neutras");
-        hCharged_vs_NeutralParticles[i]->Draw("COLZ");
-        cCharged_vs_Neutral->SaveAs(Form("plots/Charged_vs_Neutral_Jet%d.png", i+1));
-        hCharged_vs_NeutralParticles[i]->Draw("CONT1");
-        cCharged_vs_Neutral->SaveAs(Form("plots/CONT_Charged_vs_Neutral_Jet%d.png", i+1));
-        delete cCharged_vs_Neutral;
+    // Llenar vectores de jets
+    jets.resize(n);
+    for (Int_t i = 0; i < n; i++) {
+        jets[i].SetPtEtaPhiM(ev.Jet_PT[i], ev.Jet_Eta[i], ev.Jet_Phi[i], ev.Jet_Mass[i]);
     }
 
-    // Fraccion de pT cargado vs neutro
-    for (int i = 0; i < 4; i++) {
-        TCanvas* cChargedPTFraction_vs_NeutralPTFraction = new TCanvas(Form("cChargedPTFraction_vs_NeutralPTFraction%d", i),
-                                                                        Form("Fraccion de pT Cargado vs Neutro del Jet %d", i+1),
-                                                                        800, 600);
-        gStyle->SetNumberContours(10); // Numero de colores a utilizar
-        gPad->SetLogz(); // Escala logaritmica en el eje z
-        hChargedPTFraction_vs_NeutralPTFraction[i]->GetXaxis()->SetTitle("Fraccion de pT Cargado");
-        hChargedPTFraction_vs_NeutralPTFraction[i]->GetYaxis()->SetTitle("Fraccion de pT Neutro");
-        hChargedPTFraction_vs_NeutralPTFraction[i]->Draw("COLZ");
-        cChargedPTFraction_vs_NeutralPTFraction->SaveAs(Form("plots/ChargedPTFraction_vs_NeutralPTFraction_Jet%d.png", i+1));
-        delete cChargedPTFraction_vs_NeutralPTFraction;
+    for (Int_t i = 0; i < n; i++) {
+        for (Int_t j = i + 1; j < n; j++) {
+            PairFeatures pair;
+            pair.deltaR = jets[i].DeltaR(jets[j]);
+            StorePair(HistogramSet::PairIndex(i, j, fLeadingJets), pair);
+        }
     }
+}
+
+void JetAnalyzer::ReserveTracks(Int_t nTracks) {
+    // Columnas de trazas y memoria de trabajo del evento para nTracks trazas
+    if (nTracks <= fMaxTracks) return;
+    fMaxTracks = nTracks;
+    tracks.Reserve(nTracks, fLeadingJets);
+    arena.Reserve((fLeadingJets + 1) * EventArena::Bytes<ParticleInfo>(nTracks));
+}
+
+void JetAnalyzer::MatchTracks(Int_t nLeading) {
+    // Copiar las trazas a las columnas alineadas
+    ReserveTracks(ev.Track_size);
+    tracks.Fill(ev.Track_size, ev.Track_PT, ev.Track_Eta, ev.Track_Phi, ev.Track_Charge, ev.Track_D0, ev.Track_DZ);
+    fTimer.Mark(PhaseTimer::kVectors);
+
+    // La memoria de trabajo del evento anterior se libera entera
+    arena.Reset();
+
+    // DeltaR^2 de cada jet principal con todas las trazas. El kernel denso es mas rapido
+    // que la rejilla eta-phi (EtaPhiGrid) en todos los tamanos medidos con
+    // tests/bench_track_matching (de 32 a 8192 trazas)
+    for (Int_t i = 0; i < nLeading; i++) {
+        tracks.ComputeDeltaR2(ev.Jet_Eta[i], ev.Jet_Phi[i], tracks.DeltaR2(i));
+        sums[i].Reset();
+        particlesInJet[i].data = arena.Allocate<ParticleInfo>(tracks.size);
+        particlesInJet[i].size = 0;
+    }
+    profileScratch = arena.Allocate<ParticleInfo>(tracks.size);
+
+    // Asignar las trazas con el numero de jets fijo en compilacion en los casos comunes
+    switch (nLeading) {
+        case 2: AssignTracks<2>(nLeading); break;
+        case 4: AssignTracks<4>(nLeading); break;
+        case 8: AssignTracks<8>(nLeading); break;
+        default: AssignTracks<0>(nLeading); break;
+    }
+    fTimer.Mark(PhaseTimer::kMatching);
+}
+
+template <Int_t N>
+void JetAnalyzer::AssignTracks(Int_t nLeading) {
+    // N > 0: el bucle sobre los jets se desenrolla; N = 0: nLeading
+    const Int_t n = (N > 0) ? N : nLeading;
+
+    // Una sola pasada sobre las trazas: cada traza se asigna a todos los jets en cuyo cono esta
+    for (Int_t j = 0; j < tracks.size; j++) {
+        for (Int_t i = 0; i < n; i++) {
+            Float_t deltaR2 = tracks.DeltaR2(i)[j];
+            if (!(deltaR2 < kConeR2)) continue;
 
-    // pT Promedio vs Numero Total de Particulas
-    for (int i = 0; i < 4; i++) {
-        TCanvas* cAveragePT_vs_TotalParticles = new TCanvas(Form("cAveragePT_vs_TotalParticles%d", i),
-                                                            Form("pT Promedio vs Total Particulas del Jet %d", i+1),
-                                                            800, 600);
-        gStyle->SetNumberContours(10); // Numero de colores a utilizar
-        gPad->SetLogz(); // Escala logaritmica en el eje z
-        hAveragePT_vs_TotalParticles[i]->GetXaxis()->SetTitle("Numero Total de Particulas");
-        hAveragePT_vs_TotalParticles[i]->GetYaxis()->SetTitle("pT Promedio (GeV)");
-        hAveragePT_vs_TotalParticles[i]->Draw("COLZ");
-        cAveragePT_vs_TotalParticles->SaveAs(Form("plots/AveragePT_vs_TotalParticles_Jet%d.png", i+1));
-        hAveragePT_vs_TotalParticles[i]->Draw("CONT1");
-        cAveragePT_vs_TotalParticles->SaveAs(Form("plots/CONT_AveragePT_vs_TotalParticles_Jet%d.png", i+1));
-        delete cAveragePT_vs_TotalParticles;
+            Double_t deltaR = std::sqrt(deltaR2);
+            particlesInJet[i].push_back({j, deltaR, tracks.pt[j]});
+            sums[i].Add(j, deltaR, tracks.pt[j], tracks.px[j], tracks.py[j], tracks.charge[j] != 0);
+        }
     }
+}
 
-    /* Delta R vs Diferencia en pT entre pares de jets
-    for (int i = 0; i < 6; i++) {
-        TCanvas* cDeltaR_vs_PTDifference = new TCanvas(Form("cDeltaR_vs_PTDifference%d", i), Form("DeltaR vs Diferencia en pT para Par %d", i+1), 800, 600);
-        hDeltaR_vs_PTDifference[i]->GetXaxis()->SetTitle("DeltaR");
-        hDeltaR_vs_PTDifference[i]->GetYaxis()->SetTitle("|pT1 - pT2| (GeV)");
-        hDeltaR_vs_PTDifference[i]->Draw("COLZ");
-        cDeltaR_vs_PTDifference->SaveAs(Form("plots/DeltaR_vs_PTDifference_Par%d.png", i+1));
-        delete cDeltaR_vs_PTDifference;
-    }*/
-
-    // pT(par_max_pT) vs Delta R(par_max_pT, j_r)
-    for (int i = 0; i < 4; i++) {
-        TCanvas* cMaxPTRatio_vs_DeltaRMaxPT = new TCanvas(Form("cMaxPTRatio_vs_DeltaRMaxPT%d", i),
-                                                        Form("pT(par_max_pT) / pT(j_r) vs DeltaR(par_max_pT, j_r) del Jet %d", i+1),
-                                                        800, 600);
-        gStyle->SetNumberContours(10); // Numero de colores a utilizar
-        gPad->SetLogz(); // Escala logaritmica en el eje z
-        hMaxPTRatio_vs_DeltaRMaxPT[i]->GetXaxis()->SetTitle("pT(par_{max}^{PT}) / pT(j_{r})");
-        hMaxPTRatio_vs_DeltaRMaxPT[i]->GetYaxis()->SetTitle("DeltaR(par_{max}^{PT}, j_{r})");
-        hMaxPTRatio_vs_DeltaRMaxPT[i]->Draw("COLZ");
-        cMaxPTRatio_vs_DeltaRMaxPT->SaveAs(Form("plots/MaxPTRatio_vs_DeltaRMaxPT_Jet%d.png", i+1));
-        hMaxPTRatio_vs_DeltaRMaxPT[i]->Draw("CONT1");
-        cMaxPTRatio_vs_DeltaRMaxPT->SaveAs(Form("plots/CONT_MaxPTRatio_vs_DeltaRMaxPT_Jet%d.png", i+1));
-        delete cMaxPTRatio_vs_DeltaRMaxPT;
+void JetAnalyzer::ComputeTrackFeatures(Int_t i, JetFeatures& f) {
+    // Variables del jet actual
+    Float_t jetEta = ev.Jet_Eta[i];
+    Float_t jetPhi = ev.Jet_Phi[i];
+    Double_t jetPT = ev.Jet_PT[i];
+    const JetTrackSums& sum = sums[i];
+    const Float_t* deltaR2 = tracks.DeltaR2(i);
+
+    f.sumPT = sum.sumPT;
+    f.totalPT = sum.totalPT;
+    f.averagePT = (sum.countParticles > 0) ? (sum.sumPT / sum.countParticles) : 0;
+
+    Double_t maxDRPT = (sum.maxDRIndex >= 0) ? tracks.pt[sum.maxDRIndex] : 0;
+    Double_t minDRPT = (sum.minDRIndex >= 0) ? tracks.pt[sum.minDRIndex] : 0;
+
+    f.maxPTRatio = (jetPT > 0) ? (sum.maxPT / jetPT) : 0;
+    f.minPTRatio = (jetPT > 0) ? (sum.minPT / jetPT) : 0;
+    f.maxDRRatio = (jetPT > 0) ? (maxDRPT / jetPT) : 0;
+    f.minDRRatio = (jetPT > 0) ? (minDRPT / jetPT) : 0;
+
+    // Sin particulas en el cono, la referencia queda en el origen (eta = phi = 0)
+    Double_t deltaROrigin = std::sqrt(jetEta * jetEta + jetPhi * jetPhi);
+    f.deltaRMaxPT = (sum.maxPTIndex >= 0) ? std::sqrt(deltaR2[sum.maxPTIndex]) : deltaROrigin;
+    f.deltaRMinPT = (sum.minPTIndex >= 0) ? std::sqrt(deltaR2[sum.minPTIndex]) : deltaROrigin;
+    f.deltaRMaxDR = (sum.maxDRIndex >= 0) ? sum.maxDR : deltaROrigin;
+    f.deltaRMinDR = (sum.minDRIndex >= 0) ? sum.minDR : deltaROrigin;
+
+    f.ptDifference = sum.maxPT - sum.minPT;
+
+    // Contar particulas por encima y por debajo del pT promedio
+    f.particlesBelowAvgPT = 0;
+    f.particlesAboveAvgPT = 0;
+    for (const auto& pInfo : particlesInJet[i]) {
+        if (pInfo.pt < f.averagePT) {
+            f.particlesBelowAvgPT++;
+        } else {
+            f.particlesAboveAvgPT++;
+        }
     }
 
-    // R50% vs R95%
-    for (int i = 0; i < 4; i++) {
-        TCanvas* cR50_vs_R95 = new TCanvas(Form("cR50_vs_R95%d", i), Form("R50%% vs R95%% del Jet %d", i+1), 800, 600);
-        gStyle->SetNumberContours(10); // Numero de colores a utilizar
-        gPad->SetLogz(); // Escala logaritmica en el eje z
-        hR50_vs_R95[i]->GetXaxis()->SetTitle("R50% del pT total");
-        hR50_vs_R95[i]->GetYaxis()->SetTitle("R95% del pT total");
-        hR50_vs_R95[i]->Draw("COLZ");
-        cR50_vs_R95->SaveAs(Form("plots/R50_vs_R95_Jet%d.png", i+1));
-        hR50_vs_R95[i]->Draw("CONT1");
-        cR50_vs_R95->SaveAs(Form("plots/CONT_R50_vs_R95_Jet%d.png", i+1));
-        delete cR50_vs_R95;
+    // Calcular fracciones de pT (evitar division por cero)
+    const Double_t undefined = std::numeric_limits<Double_t>::quiet_NaN();
+    f.chargedPTFraction = (sum.totalPT != 0) ? sum.ChargedPT() / sum.totalPT : undefined;
+    f.neutralPTFraction = (sum.totalPT != 0) ? sum.NeutralPT() / sum.totalPT : undefined;
+
+    // R50 y R95 solo se definen con particulas en el cono (ComputeRadialProfile)
+    f.r50 = undefined;
+    f.r95 = undefined;
+}
+
+void JetAnalyzer::ComputeRadialProfile(Int_t i, JetFeatures& f) {
+    // Ordenar particulas por DeltaR (orden estable, sin std::sort)
+    ParticleList& particles = particlesInJet[i];
+    RadialProfile::Sort(particles.data, particles.size, profileScratch);
+
+    // Una sola pasada: porcentaje acumulado de pT para los histogramas del perfil radial,
+    // y R para el 50% y 95% del pT total del jet. D0 y DZ son los de la primera traza del
+    // evento, como en la version original
+    RadialPoint point;
+    point.d0 = tracks.d0[0];
+    point.dz = tracks.dz[0];
+    point.category = f.category;
+    Double_t aimPT50 = f.sumPT * 0.5;
+    Double_t aimPT95 = f.sumPT * 0.95;
+    Double_t cumulativePT = 0.0;
+    bool searching = true; // R95 encontrado: R50 y R95 ya no cambian
+    f.r50 = 0.0;
+    f.r95 = 0.0;
+
+    for (const auto& pInfo : particles) {
+        cumulativePT += pInfo.pt;
+        point.deltaR = pInfo.deltaR;
+        point.cumulativeFraction = cumulativePT / f.sumPT;
+        StorePoint(i, point);
+
+        if (!searching) continue;
+        if (cumulativePT >= aimPT50 && f.r50 == 0.0) {
+            f.r50 = pInfo.deltaR;
+        }
+        if (cumulativePT >= aimPT95 && f.r95 == 0.0) {
+            f.r95 = pInfo.deltaR;
+            searching = false;
+        }
     }
+}
+
+bool JetAnalyzer::DrawHistograms(const std::string& outputDir, const std::string& plotDir, Int_t nProcs, bool redraw) {
+    // Se dibuja lo guardado por SaveHistograms, en procesos aparte; solo lo que ha cambiado
+    fTimer.Begin(true);
+    bool drawn = PlotRenderer::Render(outputDir + "/histograms.root", plotDir, nProcs, redraw);
+    fTimer.Mark(PhaseTimer::kDraw);
+
+    if (drawn) std::cout << "Los histogramas se han dibujado y guardado correctamente." << std::endl;
+    return drawn;
+}
 
-    std::cout << "Los histogramas se han dibujado y guardado correctamente." << std::endl;
+bool JetAnalyzer::AddStoredHistograms(const std::string& path) {
+    TFile file(path.c_str(), "READ");
+    if (file.IsZombie() || !histograms->Read(file)) {
+        std::cerr << "Error: " << path << " no tiene los histogramas de esta configuracion" << std::endl;
+        return false;
+    }
+    return true;
 }
 
-void JetAnalyzer::SaveHistograms(const std::string& outputDir) {
+bool JetAnalyzer::SaveHistograms(const std::string& outputDir) {
     // Crear directorio de salida si no existe
-    std::string command = "mkdir -p " + outputDir;
-    system(command.c_str());
+    if (!MakeDirectory(outputDir)) return false;
 
     // Guarda los histogramas en un archivo ROOT
-    TFile outFile((outputDir + "/histograms.root").c_str(), "RECREATE");
-    hJetsPerEvent->Write();
-
-    for (int i = 0; i < 4; i++) {
-        hJetPT[i]->Write();
-        hJetEta[i]->Write();
-        hJetPhi[i]->Write();
-        hChargedParticles[i]->Write();
-        hNeutralsParticles[i]->Write();
-        hChargedPTFraction[i]->Write();
-        hNeutralPTFraction[i]->Write();
-        hAveragePT[i]->Write();
-        hParticlesBelowAvgPT[i]->Write();
-        hParticlesAboveAvgPT[i]->Write();
-        hMaxPTRatio[i]->Write();
-        hMinPTRatio[i]->Write();
-        hMaxDRRatio[i]->Write();
-        hMinDRRatio[i]->Write();
-        hDeltaRMaxPT[i]->Write();
-        hDeltaRMinPT[i]->Write();
-        hDeltaRMaxDR[i]->Write();
-        hDeltaRMinDR[i]->Write();
-        hPTDifference[i]->Write();
-        hR50PercentPT[i]->Write();
-        hR95PercentPT[i]->Write();
-        hCumulativePT_vs_DeltaR[i]->Write();
-        hCumulativePT_vs_DZTrack[i]->Write();
-        hCumulativePT_vs_D0Track[i]->Write();
-        hDeltaR_vs_DZTrack[i]->Write();
-        hDeltaR_vs_D0Track[i]->Write();
-        hPT_vs_Eta[i]->Write();
-        hCharged_vs_NeutralParticles[i]->Write();
-        hChargedPTFraction_vs_NeutralPTFraction[i]->Write();
-        hAveragePT_vs_TotalParticles[i]->Write();
-        hMaxPTRatio_vs_DeltaRMaxPT[i]->Write();
-        hR50_vs_R95[i]->Write();
-
+    fTimer.Begin(true);
+    std::string path = outputDir + "/histograms.root";
+    TFile outFile(path.c_str(), "RECREATE");
+    bool written = !outFile.IsZombie() && histograms->Write();
+    outFile.Close();
+    fTimer.Mark(PhaseTimer::kWrite);
+    if (!written || outFile.TestBit(TFile::kWriteError)) {
+        std::cerr << "Error: no se pudo escribir " << path << std::endl;
+        return false;
     }
 
-    for (int i = 0; i < 6; i++) {
-        hDeltaRPar[i]->Write();
-        //hDeltaR_vs_PTDifference[i]->Write();
-    }
+    // Con el resultado guardado, los puntos de control ya no hacen falta
+    if (!fConfig.checkpointDir.empty()) Checkpoint::RemoveAll(fConfig.checkpointDir);
+    return true;
+}
 
-    outFile.Close();
-}
\ No newline at end of file
+void JetAnalyzer::ReportTiming() const {
+    if (!fTimer.Enabled()) return;
+
+    Double_t eventsPerSecond = (fLoopWall > 0) ? fEventsRead / fLoopWall : 0;
+    Double_t megabytesPerSecond = (fLoopWall > 0) ? fBytesRead / fLoopWall / 1e6 : 0;
+    Double_t p50 = fTimer.Latency(0.50) / 1e3; // us
+    Double_t p99 = fTimer.Latency(0.99) / 1e3;
+
+    // Las fases se suman sobre los hilos (y los lectores): pueden superar al tiempo del bucle
+    std::cout << "Tiempos por fase (s reales / s de CPU, sumados sobre los hilos):";
+    for (Int_t p = 0; p < PhaseTimer::kPhases; p++) {
+        std::cout << " " << PhaseTimer::Name(p) << " " << fTimer.Wall(p) << "/" << fTimer.Cpu(p);
+    }
+    std::cout << std::endl;
+    std::cout << "Bucle: " << fLoopWall << " s reales, " << fLoopCpu << " s de CPU, " << fThreads << " hilos; "
+              << eventsPerSecond << " eventos/s, " << megabytesPerSecond << " MB/s; latencia por evento p50 "
+              << p50 << " us, p99 " << p99 << " us" << std::endl;
+
+    std::ofstream out(fConfig.timingReport);
+    out << "{\n"
+        << "  \"events\": " << fEventsRead << ",\n"
+        << "  \"events_selected\": " << fEventsSelected << ",\n"
+        << "  \"bytes_read\": " << fBytesRead << ",\n"
+        << "  \"threads\": " << fThreads << ",\n"
+        << "  \"read_ahead\": " << fConfig.readAhead << ",\n"
+        << "  \"event_blocks\": " << (fConfig.eventBlocks ? "true" : "false") << ",\n"
+        << "  \"loop_wall_seconds\": " << fLoopWall << ",\n"
+        << "  \"loop_cpu_seconds\": " << fLoopCpu << ",\n"
+        << "  \"events_per_second\": " << eventsPerSecond << ",\n"
+        << "  \"megabytes_per_second\": " << megabytesPerSecond << ",\n"
+        << "  \"latency_us\": {\"p50\": " << p50 << ", \"p99\": " << p99 << "},\n"
+        << "  \"phases\": {\n";
+    for (Int_t p = 0; p < PhaseTimer::kPhases; p++) {
+        out << "    \"" << PhaseTimer::Name(p) << "\": {\"wall_seconds\": " << fTimer.Wall(p)
+            << ", \"cpu_seconds\": " << fTimer.Cpu(p) << "}" << (p + 1 < PhaseTimer::kPhases ? "," : "") << "\n";
+    }
+    out << "  }\n"
+        << "}\n";
+    if (!out.flush()) {
+        std::cerr << "Error: no se pudo escribir " << fConfig.timingReport << std::endl;
+        return;
+    }
+    std::cout << "Informe de tiempos: " << fConfig.timingReport << std::endl;
+}
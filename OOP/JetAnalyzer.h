@@ -5,6 +5,9 @@
 #include <TTree.h>
 #include <TFile.h>
 #include <TChain.h>
+#include <TROOT.h>
+#include <TTreeCache.h>
+#include <TTreePerfStats.h>
 #include <TLorentzVector.h>
 #include <TH1F.h>
 #include <TH2F.h>
@@ -13,120 +16,176 @@
 #include <TStyle.h>
 #include <vector>
 #include <iostream>
-#include "MyClass.C"
+#include "DelphesReader.h"
+#include "EventArena.h"
+#include "TrackBuffer.h"
+#include "JetTrackSums.h"
+#include "RadialProfile.h"
+#include "AnalyzerConfig.h"
+#include "HistogramRegistry.h"
+#include "JetColumns.h"
+#include "Checkpoint.h"
+#include "EventView.h"
+#include "EventRing.h"
+#include "FeatureBlock.h"
+#include "PhaseTimer.h"
+#include "IoReport.h"
+#include "SelectionIndex.h"
+#include "FileSystem.h"
 
 class JetAnalyzer {
 public:
-    // Constructor y Destructor
-    JetAnalyzer(const std::vector<std::string>& inputFiles);
+    static constexpr Int_t kMaxLeadingJets = AnalyzerConfig::kMaxLeadingJets; // Jets principales por evento como maximo
+
+    // Constructor y Destructor. fileEntries: entradas de cada archivo si ya se conocen
+    // (los archivos no se abren para contarlas)
+    JetAnalyzer(const std::vector<std::string>& inputFiles, const AnalyzerConfig& config = AnalyzerConfig(),
+                const std::vector<Long64_t>& fileEntries = {});
     ~JetAnalyzer();
 
     // Métodos principales
     void InitializeHistograms();
-    void LoopEvents();
-    void DrawHistograms();
-    void SaveHistograms(const std::string& outputDir);
+    bool LoopEvents(Int_t nThreads = 1); // false si falla un directorio o la exportacion
+    // false si no se puede leer outputDir/histograms.root o algun grafico no se ha dibujado
+    bool DrawHistograms(const std::string& outputDir, const std::string& plotDir, Int_t nProcs = 1, bool redraw = false);
+    bool SaveHistograms(const std::string& outputDir);
+
+    // Suma los histogramas de un histograms.root anterior (modo incremental)
+    bool AddStoredHistograms(const std::string& path);
+
+    // Resumen de tiempos por fase y de ritmo, y su informe JSON (config.timingReport)
+    void ReportTiming() const;
+
+    // Entradas del rango a procesar
+    Long64_t Entries() const { return fLastEntry - fFirstEntry; }
+
+    // Compilado con BTAG_COUNT_ALLOCS: false (tras imprimir el error) si el analisis ha
+    // reservado memoria despues del primer evento. Sin el contador, siempre true
+    bool CheckSteadyAllocations() const;
 
 private:
     // Métodos auxiliares
+    void ActivateBranches();
+    bool Preselected() const;
+    void SelectEntry(Long64_t entry);
+    void OpenSelectionIndex();
+    void SaveSelectionIndex();
+    Long64_t NextEntry(Long64_t entry) const;
     void ProcessEvent(Long64_t entry);
+    void ReadBatch(EventBatch& batch, Long64_t& jentry, Long64_t last, PhaseTimer& timer);
+    void ReadAhead(EventRing& ring, Long64_t first, Long64_t last, PhaseTimer& timer);
+    void AnalyzeView();
+    void AnalyzeEvent();
+    void AnalyzeBatch(const EventBatch& batch);
+    void AnalyzeBlock(const EventBatch& batch);
+    void StorePair(Int_t pair, const PairFeatures& f);
+    void StorePoint(Int_t jet, const RadialPoint& f);
+    void LoopRange(Long64_t first, Long64_t last, bool showProgress);
+    void Merge(const JetAnalyzer& other);
+    Long64_t ResumeRange(Checkpoint& checkpoint, Long64_t first);
+    void SaveCheckpoint(Checkpoint& checkpoint, Long64_t next);
+    std::string CheckpointSignature() const;
+    void PrintReadStats() const;
+    void TrackIoFile(Long64_t entry);
+    void RecordIoFile();
+    void FinishIoStats();
+    void ReserveTracks(Int_t nTracks);
+    void MatchTracks(Int_t nLeading);
+    template <Int_t N> void FillPairs(Int_t nLeading);
+    template <Int_t N> void AssignTracks(Int_t nLeading);
+    void ComputeTrackFeatures(Int_t i, JetFeatures& f);
+    void ComputeRadialProfile(Int_t i, JetFeatures& f);
 
     // Miembros de datos
+    std::vector<std::string> fInputFiles;
+    std::vector<Long64_t> fFileEntries; // Entradas de cada archivo (vacio si no coinciden con el TChain)
     TChain* fChain;
-    MyClass* t;
+    DelphesReader* t;
     Long64_t nentries;
+    Long64_t fFirstEntry; // Rango de entradas a procesar: [fFirstEntry, fLastEntry)
+    Long64_t fLastEntry;
+    Long64_t fBytesRead;  // Bytes leidos del arbol en las entradas procesadas
+    Long64_t fEventsRead; // Entradas leidas
+    Long64_t fEventsSelected; // Entradas que pasan la preseleccion (se leen sus trazas)
+    Int_t fLeadingJets;   // Jets principales por evento
+
+    // Configuracion y histogramas de los observables activos
+    AnalyzerConfig fConfig;
+    HistogramSet* histograms;
+    UInt_t fNeeds; // Grupos de variables a calcular (observables activos y exportacion)
+
+    // Variables por jet exportadas de este hilo (nullptr si no se exportan)
+    JetColumns* columns;
+
+    // Evento que se analiza: ramas del lector o copia en un lote de lectura anticipada
+    EventView ev;
+    PipelineStats fPipelineStats; // Lectura anticipada, sumada sobre los rangos
+
+    // Registros del lote que se analiza, para llenar los histogramas con FillN
+    // (nullptr: analisis evento a evento)
+    FeatureBlock* records;
+
+    // Tiempos por fase de este hilo (y de su lector) y del bucle completo de LoopEvents
+    PhaseTimer fTimer;
+    Double_t fLoopWall; // s reales
+    Double_t fLoopCpu;  // s de CPU del proceso
+    Int_t fThreads;
+
+    // Estadisticas de E/S (config.ioStats). fIoTree: archivo del TChain que se esta leyendo,
+    // con las entradas [fIoBegin, fIoEnd); fIoEntries: entradas leidas de el
+    TTreePerfStats* fPerfStats;
+    IoReport fIo;
+    Int_t fIoTree;
+    Long64_t fIoBegin;
+    Long64_t fIoEnd;
+    Long64_t fIoEntries;
+
+    // Indice de seleccion (config.selectionCacheDir): lo abre el analizador principal y los
+    // hilos lo comparten. Las entradas seleccionadas se anotan si falta el indice de algun archivo
+    SelectionIndex fSelection;
+    const SelectionIndex* fIndex; // nullptr: se leen todas las entradas
+    bool fRecordSelection;
+    bool fScanComplete; // El rango se ha recorrido entero (no se ha reanudado)
+    std::vector<Long64_t> fSelectedEntries;
+
+    // Vector para almacenar jets (solo si hay observables de parejas)
+    std::vector<TLorentzVector> jets;
 
-    // Histogramas
-    // Histograma de jets por evento
-    TH1F* hJetsPerEvent;
-
-    // Histograma de pT de los jets
-    TH1F* hJetPT[4];
-
-    // Histograma de Eta de los jets
-    TH1F* hJetEta[4];
-
-    // Histograma de Phi de los jets
-    TH1F* hJetPhi[4];
-
-    // Delta R entre los primeros 4 jets, por parejas
-    TH1F* hDeltaRPar[6];
-
-    // Número de partículas cargadas por jet
-    TH1F* hChargedParticles[4];
-
-    // Número de partículas neutras por jet
-    TH1F* hNeutralsParticles[4];
-
-    // Fracción de pT cargado del jet
-    TH1F* hChargedPTFraction[4];
-
-    // Fracción de pT neutro del jet
-    TH1F* hNeutralPTFraction[4];
-
-    // pT promedio de las partículas de cada jet
-    TH1F* hAveragePT[4];
-
-    // Número de partículas con pT por debajo del pT promedio por cada jet
-    TH1F* hParticlesBelowAvgPT[4];
-
-    // Número de partículas con pT por encima del pT promedio por cada jet
-    TH1F* hParticlesAboveAvgPT[4];
-
-    // pT(par_max_pT) / pT(j_r)
-    TH1F* hMaxPTRatio[4];
-
-    // pT(par_min_pT) / pT(j_r)
-    TH1F* hMinPTRatio[4];
-
-    // pT(par_max_DR) / pT(j_r)
-    TH1F* hMaxDRRatio[4];
-
-    // pT(par_min_DR) / pT(j_r)
-    TH1F* hMinDRRatio[4];
-
-    // DeltaR(par_max_pT, j_r)
-    TH1F* hDeltaRMaxPT[4];
-
-    // DeltaR(par_min_pT, j_r)
-    TH1F* hDeltaRMinPT[4];
+    // Trazas del evento en columnas alineadas
+    TrackBuffer tracks;
+    Int_t fMaxTracks; // Trazas por evento que caben en tracks y en arena
 
-    // DeltaR(par_max_DR, j_r)
-    TH1F* hDeltaRMaxDR[4];
+    // Informacion de las particulas en el cono de un jet
+    struct ParticleInfo {
+        Int_t index;
+        Double_t deltaR;
+        Double_t pt;
+    };
 
-    // DeltaR(par_min_DR, j_r)
-    TH1F* hDeltaRMinDR[4];
+    // Particulas en el cono de un jet, en la memoria del evento (capacidad: trazas del evento)
+    struct ParticleList {
+        ParticleInfo* data;
+        Int_t size;
 
-    // pT(par_max_pT) - pT(par_min_pT)
-    TH1F* hPTDifference[4];
+        void push_back(const ParticleInfo& p) { data[size++] = p; }
+        ParticleInfo* begin() const { return data; }
+        ParticleInfo* end() const { return data + size; }
+    };
 
-    // R al 50% del pT total del jet
-    TH1F* hR50PercentPT[4];
+    // Memoria de trabajo del evento: particulas por jet y orden radial
+    EventArena arena;
 
-    // R al 95% del pT total del jet
-    TH1F* hR95PercentPT[4];
+    // Particulas y acumuladores de cada jet principal
+    std::vector<ParticleList> particlesInJet;
+    std::vector<JetTrackSums> sums;
 
-    // Histograma 2D de DeltaR vs Porcentaje acumulado de pT
-    TH2F* hCumulativePT_vs_DeltaR[4];
+    // Espacio auxiliar para ordenar las particulas de un jet por DeltaR
+    ParticleInfo* profileScratch;
 
-    // Nuevos Histogramas 2D
-    TH2F* hPT_vs_Eta[4]; // pT vs Eta para los primeros 4 jets
-    TH2F* hCharged_vs_NeutralParticles[4]; // Número de Partículas Cargadas vs Neutras
-    TH2F* hChargedPTFraction_vs_NeutralPTFraction[4]; // Fracción de pT Cargado vs Neutro
-    TH2F* hAveragePT_vs_TotalParticles[4]; // pT Promedio vs Número Total de Partículas
-    //TH2F* hDeltaR_vs_PTDifference[6]; // Delta R vs Diferencia en pT entre pares de jets
-    TH2F* hMaxPTRatio_vs_DeltaRMaxPT[4]; // pT(par_max_pT) vs Delta R(par_max_pT, j_r)
-    TH2F* hR50_vs_R95[4]; // R50% vs R95%
-    
-    // Nuevos histogramas relacionados con D0 y DZ
-    TH2F* hCumulativePT_vs_DZTrack[4];   // Porcentaje acumulado de pT vs DZ del Track
-    TH2F* hCumulativePT_vs_D0Track[4];    // Porcentaje acumulado de pT vs D0 del Track
-    TH2F* hDeltaR_vs_DZTrack[4];          // DeltaR entre Track y Jet vs DZ del Track
-    TH2F* hDeltaR_vs_D0Track[4];          // DeltaR entre Track y Jet vs D0 del Track
+    Long64_t fSteadyAllocations; // Reservas de memoria en ProcessEvent tras el primer evento (BTAG_COUNT_ALLOCS)
 
-    // Vectores para almacenar jets y partículas
-    std::vector<TLorentzVector> jets;
-    std::vector<TLorentzVector> particles;
+    static constexpr Float_t kConeR2 = 0.4f * 0.4f; // Radio del cono al cuadrado
+    static constexpr Int_t kBlockPoints = 32 * EventBatch::kEvents; // Puntos del perfil por jet acumulados antes de llenar
 };
 
 #endif // JETANALYZER_H
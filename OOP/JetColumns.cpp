@@ -0,0 +1,216 @@
+#include "JetColumns.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <unistd.h>
+
+const std::vector<JetColumns::Column>& JetColumns::Columns() {
+    static const std::vector<Column> columns = {
+        {"index",               [](const JetFeatures& f) -> Float_t { return f.index; }},
+        {"pt",                  [](const JetFeatures& f) -> Float_t { return f.pt; }},
+        {"eta",                 [](const JetFeatures& f) -> Float_t { return f.eta; }},
+        {"phi",                 [](const JetFeatures& f) -> Float_t { return f.phi; }},
+        {"nCharged",            [](const JetFeatures& f) -> Float_t { return f.nCharged; }},
+        {"nNeutrals",           [](const JetFeatures& f) -> Float_t { return f.nNeutrals; }},
+        {"sumPT",               [](const JetFeatures& f) -> Float_t { return f.sumPT; }},
+        {"chargedPTFraction",   [](const JetFeatures& f) -> Float_t { return f.chargedPTFraction; }},
+        {"neutralPTFraction",   [](const JetFeatures& f) -> Float_t { return f.neutralPTFraction; }},
+        {"averagePT",           [](const JetFeatures& f) -> Float_t { return f.averagePT; }},
+        {"particlesBelowAvgPT", [](const JetFeatures& f) -> Float_t { return f.particlesBelowAvgPT; }},
+        {"particlesAboveAvgPT", [](const JetFeatures& f) -> Float_t { return f.particlesAboveAvgPT; }},
+        {"maxPTRatio",          [](const JetFeatures& f) -> Float_t { return f.maxPTRatio; }},
+        {"minPTRatio",          [](const JetFeatures& f) -> Float_t { return f.minPTRatio; }},
+        {"maxDRRatio",          [](const JetFeatures& f) -> Float_t { return f.maxDRRatio; }},
+        {"minDRRatio",          [](const JetFeatures& f) -> Float_t { return f.minDRRatio; }},
+        {"deltaRMaxPT",         [](const JetFeatures& f) -> Float_t { return f.deltaRMaxPT; }},
+        {"deltaRMinPT",         [](const JetFeatures& f) -> Float_t { return f.deltaRMinPT; }},
+        {"deltaRMaxDR",         [](const JetFeatures& f) -> Float_t { return f.deltaRMaxDR; }},
+        {"deltaRMinDR",         [](const JetFeatures& f) -> Float_t { return f.deltaRMinDR; }},
+        {"ptDifference",        [](const JetFeatures& f) -> Float_t { return f.ptDifference; }},
+        {"r50",                 [](const JetFeatures& f) -> Float_t { return f.r50; }},
+        {"r95",                 [](const JetFeatures& f) -> Float_t { return f.r95; }},
+        {"flavor",              [](const JetFeatures& f) -> Float_t { return f.flavor; }},
+        {"btag",                [](const JetFeatures& f) -> Float_t { return f.btag; }}
+    };
+    return columns;
+}
+
+JetColumns::JetColumns(const std::string& spillPath, bool keep)
+    : fSpillPath(spillPath), fSpill(nullptr), fBlockRows(0), fRows(0) {
+    if (keep) fSpill = std::fopen(spillPath.c_str(), "r+b");
+    if (!fSpill) fSpill = std::fopen(spillPath.c_str(), "w+b");
+    if (!fSpill) {
+        std::cerr << "Error: no se pudo crear el archivo temporal " << spillPath << std::endl;
+    }
+    fBlock.resize(Columns().size() * kBlockRows);
+}
+
+JetColumns::~JetColumns() {
+    if (fSpill) {
+        std::fclose(fSpill);
+        std::remove(fSpillPath.c_str());
+    }
+}
+
+void JetColumns::FlushBlock() {
+    if (fBlockRows == 0) return;
+    if (fSpill) {
+        for (size_t c = 0; c < Columns().size(); c++) {
+            std::fwrite(&fBlock[c * kBlockRows], sizeof(Float_t), fBlockRows, fSpill);
+        }
+    }
+    fBlockRows = 0;
+}
+
+bool JetColumns::Save(FILE* out) {
+    if (!fSpill || std::fflush(fSpill) != 0) return false;
+    for (size_t c = 0; c < Columns().size(); c++) {
+        std::fwrite(&fBlock[c * kBlockRows], sizeof(Float_t), fBlockRows, out);
+    }
+    return !std::ferror(out);
+}
+
+bool JetColumns::Restore(Long64_t rows, FILE* in) {
+    Int_t blockRows = rows % kBlockRows;
+    Long64_t spillBytes = (rows - blockRows) * (Long64_t)Columns().size() * sizeof(Float_t);
+
+    // El archivo temporal debe tener al menos los bloques completos del punto de control
+    if (!fSpill || fseeko(fSpill, 0, SEEK_END) != 0 || ftello(fSpill) < spillBytes) return false;
+    if (ftruncate(fileno(fSpill), spillBytes) != 0 || fseeko(fSpill, spillBytes, SEEK_SET) != 0) return false;
+
+    for (size_t c = 0; blockRows > 0 && c < Columns().size(); c++) {
+        if ((Int_t)std::fread(&fBlock[c * kBlockRows], sizeof(Float_t), blockRows, in) != blockRows) return false;
+    }
+    fBlockRows = blockRows;
+    fRows = rows;
+    return true;
+}
+
+std::string JetColumns::Header(Long64_t nRows) {
+    // Cabecera .npy (version 1.0): magic, version, longitud y diccionario de longitud fija,
+    // para que al agregar filas la forma se reescriba en el mismo sitio
+    std::string header = "{'descr': '<f4', 'fortran_order': False, 'shape': (" + std::to_string(nRows) + ",), }";
+    header.append(kHeaderBytes - 11 - header.size(), ' ');
+    header += '\n';
+    UShort_t length = header.size();
+    return std::string("\x93NUMPY\x01\x00", 8) + (char)(length & 0xff) + (char)(length >> 8) + header;
+}
+
+bool JetColumns::ReadShape(FILE* in, Long64_t& nRows) {
+    std::string header(kHeaderBytes, '\0');
+    if (std::fread(&header[0], 1, kHeaderBytes, in) != (size_t)kHeaderBytes) return false;
+    if (header.compare(0, 8, "\x93NUMPY\x01\x00", 8) != 0) return false;
+    if ((unsigned char)header[8] + ((unsigned char)header[9] << 8) != kHeaderBytes - 10) return false;
+    if (header.find("'<f4'") == std::string::npos || header.find("'fortran_order': False") == std::string::npos) {
+        return false;
+    }
+    size_t shape = header.find("'shape': (");
+    if (shape == std::string::npos) return false;
+    return std::sscanf(header.c_str() + shape, "'shape': (%lld,)", &nRows) == 1;
+}
+
+bool JetColumns::WriteColumn(size_t c, const std::vector<JetColumns*>& parts, FILE* out) {
+    // Cada bloque del archivo temporal esta guardado columna a columna: el trozo de la
+    // columna c de un bloque de rows filas empieza en c * rows
+    const Long64_t nColumns = Columns().size();
+    std::vector<Float_t> buffer(kBlockRows);
+    for (auto* part : parts) {
+        for (Long64_t first = 0; first < part->fRows; first += kBlockRows) {
+            Long64_t rows = std::min<Long64_t>(kBlockRows, part->fRows - first);
+            Long64_t offset = (first * nColumns + c * rows) * sizeof(Float_t);
+            if (fseeko(part->fSpill, offset, SEEK_SET) != 0 ||
+                (Long64_t)std::fread(buffer.data(), sizeof(Float_t), rows, part->fSpill) != rows) {
+                return false;
+            }
+            std::fwrite(buffer.data(), sizeof(Float_t), rows, out);
+        }
+    }
+    return !std::ferror(out);
+}
+
+bool JetColumns::Write(const std::string& stem, const std::vector<JetColumns*>& parts, bool append) {
+    const std::vector<Column>& columns = Columns();
+
+    Long64_t nRows = 0;
+    for (auto* part : parts) {
+        if (!part->IsOpen()) return false;
+        part->FlushBlock();
+        std::fflush(part->fSpill);
+        nRows += part->fRows;
+    }
+
+    // Con append, todas las columnas deben tener las mismas filas
+    Long64_t previousRows = 0;
+    for (size_t c = 0; append && c < columns.size(); c++) {
+        std::string path = ColumnPath(stem, columns[c].name);
+        Long64_t rows = -1;
+        FILE* in = std::fopen(path.c_str(), "rb");
+        bool valid = in && ReadShape(in, rows) && (c == 0 || rows == previousRows);
+        if (in) std::fclose(in);
+        if (!valid) {
+            std::cerr << "Error: " << path << " no es una columna de la exportacion de " << stem << std::endl;
+            return false;
+        }
+        previousRows = rows;
+    }
+
+    // Con append, las filas nuevas se escriben al final de cada columna y, cuando todas
+    // estan en disco, se actualiza la forma de las cabeceras (una interrupcion deja la
+    // exportacion anterior). Sin append, cada columna se escribe aparte y se reemplaza con rename
+    for (size_t c = 0; c < columns.size(); c++) {
+        std::string path = ColumnPath(stem, columns[c].name);
+        std::string outPath = append ? path : path + ".tmp";
+        FILE* out = std::fopen(outPath.c_str(), append ? "r+b" : "wb");
+        if (!out) {
+            std::cerr << "Error: no se pudo crear " << outPath << std::endl;
+            return false;
+        }
+        bool written = true;
+        if (append) {
+            // Lo que haya detras de las filas de la cabecera (un intento anterior interrumpido) se descarta
+            Long64_t end = kHeaderBytes + previousRows * (Long64_t)sizeof(Float_t);
+            written = ftruncate(fileno(out), end) == 0 && fseeko(out, end, SEEK_SET) == 0;
+        } else {
+            std::string header = Header(nRows);
+            std::fwrite(header.data(), 1, header.size(), out);
+        }
+        written = written && WriteColumn(c, parts, out);
+        if (append) written = written && std::fflush(out) == 0 && fsync(fileno(out)) == 0;
+        written = (std::fclose(out) == 0) && written;
+        if (!written || (!append && std::rename(outPath.c_str(), path.c_str()) != 0)) {
+            std::cerr << "Error: no se pudo escribir " << path << std::endl;
+            if (!append) std::remove(outPath.c_str());
+            return false;
+        }
+    }
+    for (size_t c = 0; append && c < columns.size(); c++) {
+        std::string path = ColumnPath(stem, columns[c].name);
+        std::string header = Header(previousRows + nRows);
+        FILE* out = std::fopen(path.c_str(), "r+b");
+        bool written = out && std::fwrite(header.data(), 1, header.size(), out) == header.size();
+        if (out) written = (std::fclose(out) == 0) && written;
+        if (!written) {
+            std::cerr << "Error: no se pudo escribir " << path << std::endl;
+            return false;
+        }
+    }
+
+    // Nombres de las columnas, una por linea
+    std::string namesPath = stem + ".columns.txt";
+    FILE* names = std::fopen(namesPath.c_str(), "w");
+    bool named = names != nullptr;
+    for (size_t c = 0; named && c < columns.size(); c++) {
+        named = std::fprintf(names, "%s\n", columns[c].name) > 0;
+    }
+    if (names) named = (std::fclose(names) == 0) && named;
+    if (!named) {
+        std::cerr << "Error: no se pudo escribir " << namesPath << std::endl;
+        return false;
+    }
+
+    std::cout << "Variables de " << nRows << " jets exportadas a " << stem << ".*.npy";
+    if (previousRows > 0) std::cout << " (" << previousRows + nRows << " en total)";
+    std::cout << std::endl;
+    return true;
+}
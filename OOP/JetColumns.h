@@ -0,0 +1,87 @@
+#ifndef JETCOLUMNS_H
+#define JETCOLUMNS_H
+
+#include <Rtypes.h>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "JetFeatures.h"
+
+// Exportacion de las variables por jet para el entrenamiento en Python. Cada columna es un
+// .npy float32 de forma (jets,), <stem>.<columna>.npy, que np.load(..., mmap_mode="r")
+// mapea sin copiar como un array contiguo. Los jets de una ejecucion incremental se
+// agregan al final de cada columna y solo se reescribe la forma de la cabecera, de
+// longitud fija. Los nombres de las columnas, en orden, van en <stem>.columns.txt. Las
+// variables no definidas para un jet (fracciones sin pT parcial, R50/R95 sin particulas)
+// se guardan como NaN.
+//
+// Cada hilo escribe sus filas en un archivo temporal por bloques de kBlockRows jets
+// (columna a columna dentro del bloque); al final se concatenan en el orden de los rangos.
+class JetColumns {
+public:
+    static constexpr Int_t kBlockRows = 4096;
+    static constexpr Int_t kHeaderBytes = 128; // Cabecera .npy completa, con la forma
+    static constexpr const char* kFormat = "f4-columns"; // Formato de los .npy, para las firmas
+
+    struct Column {
+        const char* name;
+        Float_t (*value)(const JetFeatures&);
+    };
+
+    // Columnas exportadas, en el orden de <stem>.columns.txt
+    static const std::vector<Column>& Columns();
+
+    // Archivo .npy de una columna
+    static std::string ColumnPath(const std::string& stem, const char* name) { return stem + "." + name + ".npy"; }
+
+    // Abre el archivo temporal del hilo; con keep se conserva su contenido (para Restore)
+    explicit JetColumns(const std::string& spillPath, bool keep = false);
+    ~JetColumns();
+    JetColumns(const JetColumns&) = delete;
+    JetColumns& operator=(const JetColumns&) = delete;
+
+    bool IsOpen() const { return fSpill != nullptr; }
+
+    // Agrega un jet; vuelca el bloque al archivo temporal cuando se llena
+    void Add(const JetFeatures& f) {
+        const std::vector<Column>& columns = Columns();
+        for (size_t c = 0; c < columns.size(); c++) {
+            fBlock[c * kBlockRows + fBlockRows] = columns[c].value(f);
+        }
+        if (++fBlockRows == kBlockRows) FlushBlock();
+        fRows++;
+    }
+
+    Long64_t Rows() const { return fRows; }
+
+    // Punto de control: los bloques completos quedan en el archivo temporal y el bloque
+    // parcial se escribe en out. Restore vuelve a ese estado (con rows = Rows() de entonces)
+    // y descarta las filas agregadas despues; Restore(0, nullptr) vacia la exportacion
+    bool Save(FILE* out);
+    bool Restore(Long64_t rows, FILE* in);
+
+    // Escribe las columnas de stem y sus nombres a partir de las partes de cada hilo, en
+    // orden. Con append, las filas nuevas se agregan detras de las que ya tenia cada columna
+    // sin leerlas
+    static bool Write(const std::string& stem, const std::vector<JetColumns*>& parts, bool append = false);
+
+private:
+    void FlushBlock();
+
+    // Cabecera .npy de kHeaderBytes bytes para la forma (filas,)
+    static std::string Header(Long64_t nRows);
+
+    // Filas de una columna escrita por Write; los datos empiezan en kHeaderBytes
+    static bool ReadShape(FILE* in, Long64_t& nRows);
+
+    // Filas de la columna c de todas las partes, en orden; false si falta alguna
+    static bool WriteColumn(size_t c, const std::vector<JetColumns*>& parts, FILE* out);
+
+    std::string fSpillPath;
+    FILE* fSpill;
+    std::vector<Float_t> fBlock; // Bloque actual: columna c en [c * kBlockRows, ...)
+    Int_t fBlockRows;
+    Long64_t fRows;
+};
+
+#endif // JETCOLUMNS_H
@@ -0,0 +1,90 @@
+#ifndef JETFEATURES_H
+#define JETFEATURES_H
+
+#include <Rtypes.h>
+
+// Registros de variables sobre los que se definen los histogramas del registro.
+// Cada observable declara que grupos de variables necesita (kNeeds*) y el analizador
+// solo calcula los grupos que piden los observables activos.
+
+// Grupos de variables
+enum FeatureNeeds : UInt_t {
+    kNeedsPairs   = 1 << 0, // TLorentzVector de los jets para el DeltaR entre parejas
+    kNeedsTracks  = 1 << 1, // Asignacion de trazas a los jets y sus acumuladores
+    kNeedsProfile = 1 << 2, // Perfil radial: orden por DeltaR, pT acumulado, R50 y R95
+    kNeedsLabels  = 1 << 3  // Etiquetas del jet (Jet.Flavor, Jet.BTag)
+};
+
+// Categoria de sabor de un jet segun Jet.Flavor (codigo PDG del parton; 0 sin asignar):
+// b, c y ligeros (u, d, s, gluones y sin asignar)
+enum FlavorCategory : Int_t { kFlavorB, kFlavorC, kFlavorLight, kFlavorCategories };
+
+inline Int_t FlavorCategoryOf(UInt_t flavor) {
+    return (flavor == 5) ? kFlavorB : (flavor == 4) ? kFlavorC : kFlavorLight;
+}
+
+inline const char* FlavorCategoryName(Int_t category) {
+    static const char* names[kFlavorCategories] = {"b", "c", "light"};
+    return names[category];
+}
+
+// Variables del evento
+struct EventFeatures {
+    Int_t nJets;
+};
+
+// Variables de una pareja de jets principales
+struct PairFeatures {
+    Double_t deltaR;
+};
+
+// Variables de un jet principal
+struct JetFeatures {
+    // Posicion entre los jets principales (0: el primero)
+    Int_t index;
+
+    // Cinematica del jet
+    Double_t pt;
+    Double_t eta;
+    Double_t phi;
+    Int_t nCharged;
+    Int_t nNeutrals;
+
+    // Trazas en el cono (kNeedsTracks)
+    Double_t sumPT;
+    Double_t totalPT;
+    Double_t averagePT;
+    Int_t particlesBelowAvgPT;
+    Int_t particlesAboveAvgPT;
+    Double_t maxPTRatio;
+    Double_t minPTRatio;
+    Double_t maxDRRatio;
+    Double_t minDRRatio;
+    Double_t deltaRMaxPT;
+    Double_t deltaRMinPT;
+    Double_t deltaRMaxDR;
+    Double_t deltaRMinDR;
+    Double_t ptDifference;
+    Double_t chargedPTFraction; // Solo si totalPT != 0; si no, NaN
+    Double_t neutralPTFraction; // Solo si totalPT != 0; si no, NaN
+
+    // Perfil radial (kNeedsProfile, solo si sumPT != 0; si no, NaN)
+    Double_t r50;
+    Double_t r95;
+
+    // Etiquetas (kNeedsLabels)
+    UInt_t flavor;
+    UInt_t btag;
+    Int_t category; // FlavorCategoryOf(flavor)
+};
+
+// Un punto del perfil radial: una particula del cono en orden creciente de DeltaR
+struct RadialPoint {
+    Double_t deltaR;
+    Double_t cumulativeFraction;
+    Double_t d0;
+    Double_t dz;
+    Int_t category; // La del jet (kNeedsLabels)
+};
+
+#endif // JETFEATURES_H
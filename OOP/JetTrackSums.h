@@ -0,0 +1,76 @@
+#ifndef JETTRACKSUMS_H
+#define JETTRACKSUMS_H
+
+#include <Rtypes.h>
+#include <cmath>
+
+// Acumuladores por jet que se actualizan al asignar cada traza de su cono
+struct JetTrackSums {
+    Double_t sumPT;
+    Int_t countParticles;
+
+    // Suma vectorial (px, py) de las trazas cargadas y neutras, y la suma de sus pT parciales
+    Double_t chargedPx, chargedPy;
+    Double_t neutralPx, neutralPy;
+    Double_t totalPT;
+
+    // Trazas con maximo/minimo pT y DeltaR (indice -1 si no hay)
+    Int_t maxPTIndex, minPTIndex, maxDRIndex, minDRIndex;
+    Double_t maxPT, minPT;
+    Double_t maxDR, minDR;
+
+    void Reset() {
+        sumPT = 0.0;
+        countParticles = 0;
+        chargedPx = chargedPy = 0.0;
+        neutralPx = neutralPy = 0.0;
+        totalPT = 0.0;
+        maxPTIndex = minPTIndex = maxDRIndex = minDRIndex = -1;
+        maxPT = 0;
+        minPT = 1e9;
+        maxDR = -1;
+        minDR = 1e9;
+    }
+
+    void Add(Int_t index, Double_t deltaR, Double_t pt, Double_t px, Double_t py, bool charged) {
+        // Sumar pT y contar particulas
+        sumPT += pt;
+        countParticles++;
+
+        // Actualizar particulas con maximo y minimo pT
+        if (pt > maxPT) {
+            maxPT = pt;
+            maxPTIndex = index;
+        }
+        if (pt < minPT) {
+            minPT = pt;
+            minPTIndex = index;
+        }
+
+        // Actualizar particulas con maximo y minimo DeltaR
+        if (deltaR > maxDR) {
+            maxDR = deltaR;
+            maxDRIndex = index;
+        }
+        if (deltaR < minDR) {
+            minDR = deltaR;
+            minDRIndex = index;
+        }
+
+        // Sumar pT cargado y neutro (suma vectorial en el plano transverso)
+        if (charged) {
+            chargedPx += px;
+            chargedPy += py;
+            totalPT += std::hypot(chargedPx, chargedPy);
+        } else {
+            neutralPx += px;
+            neutralPy += py;
+            totalPT += std::hypot(neutralPx, neutralPy);
+        }
+    }
+
+    Double_t ChargedPT() const { return std::hypot(chargedPx, chargedPy); }
+    Double_t NeutralPT() const { return std::hypot(neutralPx, neutralPy); }
+};
+
+#endif // JETTRACKSUMS_H
@@ -0,0 +1,136 @@
+#ifndef PHASETIMER_H
+#define PHASETIMER_H
+
+#include <Rtypes.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <ctime>
+
+// Tiempos por fase de un hilo del analisis. El codigo marca el final de cada fase con
+// Mark(fase): el tiempo desde la marca anterior se asigna a esa fase. Un tramo (un evento,
+// un lote o una escritura) empieza con Begin y, si es analisis, termina con End, que anota
+// su latencia por evento.
+//
+// El tiempo real se mide en todas las marcas (steady_clock, barato). El reloj de CPU del
+// hilo es mucho mas caro, asi que se lee solo en uno de cada kCpuSample tramos: la CPU de
+// cada fase se estima con la proporcion CPU / tiempo real de los tramos muestreados.
+class PhaseTimer {
+public:
+    enum Phase {
+        kLoad,       // LoadTree: cambio de archivo del TChain
+        kDecompress, // GetEntry: lectura y descompresion de las ramas
+        kVectors,    // Copia a columnas (lotes, trazas) y TLorentzVector de las parejas
+        kMatching,   // Asignacion de trazas a los jets y variables de las trazas
+        kProfile,    // Perfil radial: orden por DeltaR, pT acumulado, R50 y R95
+        kFill,       // Llenado de histogramas y columnas exportadas
+        kDraw,       // Dibujo de los graficos
+        kWrite,      // Escritura de histogramas, columnas y puntos de control
+        kPhases
+    };
+
+    static const char* Name(Int_t phase) {
+        static const char* names[kPhases] = {"load", "decompress", "vectors", "matching",
+                                             "profile", "fill", "draw", "write"};
+        return names[phase];
+    }
+
+    static constexpr Int_t kCpuSample = 16;
+    static constexpr Int_t kLatencyBins = 16 * 40; // 16 por potencia de 2 de ns: hasta ~18 min
+
+    explicit PhaseTimer(bool enabled = false) : fEnabled(enabled) {}
+
+    bool Enabled() const { return fEnabled; }
+
+    // Empieza un tramo; cpu: leer siempre el reloj de CPU (tramos largos y poco frecuentes)
+    void Begin(bool cpu = false) {
+        if (!fEnabled) return;
+        fSampling = cpu || (fSpans++ % kCpuSample == 0);
+        fLast = fSpanStart = Clock::now();
+        if (fSampling) fLastCpu = ThreadCpu();
+    }
+
+    // Fin de la fase phase
+    void Mark(Int_t phase) {
+        if (!fEnabled) return;
+        Clock::time_point now = Clock::now();
+        Double_t wall = std::chrono::duration<Double_t>(now - fLast).count();
+        fLast = now;
+        fWall[phase] += wall;
+        if (fSampling) {
+            Double_t cpu = ThreadCpu();
+            fSampledWall[phase] += wall;
+            fSampledCpu[phase] += cpu - fLastCpu;
+            fLastCpu = cpu;
+        }
+    }
+
+    // Fin de un tramo de analisis de events eventos: latencia por evento
+    void End(Int_t events) {
+        if (!fEnabled || events <= 0) return;
+        Double_t ns = std::chrono::duration<Double_t, std::nano>(Clock::now() - fSpanStart).count() / events;
+        Int_t bin = (ns > 1) ? std::min<Int_t>((Int_t)(std::log2(ns) * 16), kLatencyBins - 1) : 0;
+        fLatency[bin] += events;
+        fEvents += events;
+    }
+
+    void Add(const PhaseTimer& other) {
+        for (Int_t p = 0; p < kPhases; p++) {
+            fWall[p] += other.fWall[p];
+            fSampledWall[p] += other.fSampledWall[p];
+            fSampledCpu[p] += other.fSampledCpu[p];
+        }
+        for (Int_t b = 0; b < kLatencyBins; b++) {
+            fLatency[b] += other.fLatency[b];
+        }
+        fEvents += other.fEvents;
+    }
+
+    // Tiempo real de la fase, sumado sobre los hilos (s)
+    Double_t Wall(Int_t phase) const { return fWall[phase]; }
+
+    // CPU estimada de la fase, sumada sobre los hilos (s)
+    Double_t Cpu(Int_t phase) const {
+        return (fSampledWall[phase] > 0) ? fWall[phase] * fSampledCpu[phase] / fSampledWall[phase] : 0;
+    }
+
+    // Cuantil q de la latencia por evento (ns), centro geometrico de su intervalo
+    Double_t Latency(Double_t q) const {
+        if (fEvents == 0) return 0;
+        Long64_t rank = (Long64_t)std::ceil(q * fEvents);
+        Long64_t seen = 0;
+        Int_t b = 0;
+        for (; b < kLatencyBins - 1; b++) {
+            seen += fLatency[b];
+            if (seen >= rank) break;
+        }
+        return std::exp2((b + 0.5) / 16);
+    }
+
+    static Double_t ThreadCpu() { return ClockSeconds(CLOCK_THREAD_CPUTIME_ID); }
+    static Double_t ProcessCpu() { return ClockSeconds(CLOCK_PROCESS_CPUTIME_ID); }
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    static Double_t ClockSeconds(clockid_t clock) {
+        timespec ts;
+        clock_gettime(clock, &ts);
+        return ts.tv_sec + 1e-9 * ts.tv_nsec;
+    }
+
+    bool fEnabled;
+    bool fSampling = false;
+    Long64_t fSpans = 0;
+    Clock::time_point fSpanStart;
+    Clock::time_point fLast;
+    Double_t fLastCpu = 0;
+
+    Double_t fWall[kPhases] = {};
+    Double_t fSampledWall[kPhases] = {};
+    Double_t fSampledCpu[kPhases] = {};
+    Long64_t fLatency[kLatencyBins] = {};
+    Long64_t fEvents = 0; // Eventos con latencia
+};
+
+#endif // PHASETIMER_H
@@ -0,0 +1,285 @@
+#include "PlotRenderer.h"
+#include "Checkpoint.h"
+#include "FileSystem.h"
+#include <TCanvas.h>
+#include <TFile.h>
+#include <TLegend.h>
+#include <TROOT.h>
+#include <TStyle.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+bool PlotRenderer::Render(const std::string& input, const std::string& plotDir, Int_t nProcs, bool force) {
+    if (!MakeDirectory(plotDir)) return false;
+
+    TH1::AddDirectory(kFALSE);
+    TFile file(input.c_str(), "READ");
+    if (file.IsZombie()) {
+        std::cerr << "Error: no se pudo abrir " << input << std::endl;
+        return false;
+    }
+
+    // Graficos de los observables del registro que tiene el archivo
+    const HistogramRegistry& registry = HistogramRegistry::Default();
+    std::vector<Plot> plots;
+    Collect(file, registry.eventObservables, plots);
+    Collect(file, registry.pairObservables, plots);
+    Collect(file, registry.jetObservables, plots);
+    Collect(file, registry.pointObservables, plots);
+    file.Close();
+
+    std::string statePath = plotDir + "/render_state.txt";
+    std::map<std::string, std::string> state = LoadState(statePath);
+
+    // Pendientes: graficos con otra huella o a los que les falta alguna imagen
+    std::vector<const Plot*> pending;
+    for (const auto& plot : plots) {
+        auto previous = state.find(plot.info->name);
+        bool current = !force && previous != state.end() && previous->second == plot.hash;
+        for (const auto& name : plot.files) {
+            current = current && Exists(plotDir + "/" + name);
+        }
+        if (!current) pending.push_back(&plot);
+    }
+
+    // El proceso p dibuja los graficos p, p + nProcs, ... Los canvas no se comparten entre
+    // procesos; si no se puede crear un proceso, sus graficos se dibujan en este
+    gROOT->SetBatch(kTRUE);
+    gStyle->SetOptStat(0); // Desactivar la caja de estadisticas
+    Int_t nPending = pending.size();
+    nProcs = std::max(1, std::min(nProcs, nPending));
+    std::vector<char> drawn(nPending, 0);
+    std::vector<pid_t> children(nProcs, -1);
+    if (nProcs > 1) {
+        std::cout.flush();
+        std::cerr.flush();
+        std::fflush(nullptr);
+        for (Int_t p = 0; p < nProcs; p++) {
+            children[p] = fork();
+            if (children[p] == 0) {
+                // El estado de salida indica al padre si se han guardado todas las imagenes
+                bool ok = true;
+                for (Int_t k = p; k < nPending; k += nProcs) {
+                    ok = Draw(*pending[k], plotDir) && ok;
+                }
+                std::fflush(nullptr);
+                _exit(ok ? 0 : 1);
+            }
+        }
+    }
+    for (Int_t p = 0; p < nProcs; p++) {
+        if (children[p] > 0) {
+            int status = 0;
+            bool ok = waitpid(children[p], &status, 0) == children[p] && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+            if (!ok) std::cerr << "Error: el proceso de dibujo " << p << " ha fallado" << std::endl;
+            for (Int_t k = p; k < nPending; k += nProcs) {
+                drawn[k] = ok;
+            }
+        } else {
+            for (Int_t k = p; k < nPending; k += nProcs) {
+                drawn[k] = Draw(*pending[k], plotDir);
+            }
+        }
+    }
+
+    // Huellas de los graficos dibujados; los que han fallado se repiten la proxima vez
+    for (Int_t k = 0; k < nPending; k++) {
+        if (drawn[k]) {
+            state[pending[k]->info->name] = pending[k]->hash;
+        } else {
+            state.erase(pending[k]->info->name);
+        }
+    }
+    bool saved = SaveState(statePath, state);
+
+    Int_t failed = std::count(drawn.begin(), drawn.end(), 0);
+    std::cout << "Graficos dibujados: " << nPending - failed << " de " << plots.size() << " (" << nProcs
+              << " procesos); " << plots.size() - nPending << " sin cambios" << std::endl;
+
+    for (auto& plot : plots) {
+        for (TH1* h : plot.copies) {
+            delete h;
+        }
+    }
+    return failed == 0 && saved;
+}
+
+template <class Record>
+void PlotRenderer::Collect(TFile& file, const std::vector<Observable<Record>>& defs, std::vector<Plot>& plots) {
+    for (const auto& def : defs) {
+        // Copias con los nombres de HistogramSet; las de los observables no activos no estan
+        Plot plot;
+        plot.info = &def;
+        for (Int_t k = 0;; k++) {
+            TH1* h = dynamic_cast<TH1*>(file.Get(HistogramSet::CopyName(def, k)));
+            if (!h) break;
+            h->SetDirectory(nullptr);
+            plot.copies.push_back(h);
+            if (def.scope == kEventScope) break;
+        }
+        if (plot.copies.empty()) continue;
+
+        // n jets principales tienen n(n-1)/2 parejas
+        Int_t nCopies = plot.copies.size();
+        plot.nJets = nCopies;
+        if (def.scope == kPairScope) {
+            for (plot.nJets = 2; plot.nJets * (plot.nJets - 1) / 2 < nCopies; plot.nJets++) {}
+        }
+
+        if (def.Is2D()) {
+            for (Int_t k = 0; k < nCopies; k++) {
+                for (size_t o = 0; o < def.drawOptions.size(); o++) {
+                    const char* prefix = (o == 0) ? "" : "CONT_";
+                    plot.files.push_back(Form("%s%s_Jet%d.png", prefix, def.plotName.c_str(), k + 1));
+                }
+            }
+        } else {
+            plot.files.push_back(def.plotName + ".png");
+        }
+        plot.hash = Hash(plot);
+        plots.push_back(plot);
+    }
+}
+
+std::string PlotRenderer::Hash(const Plot& plot) {
+    // Estilo del grafico y, por copia, titulos, color y contenido de todos los bins
+    const ObservableInfo& info = *plot.info;
+    std::vector<std::string> parts = {"render 1", info.plotName, info.canvasTitle, std::to_string(info.logy),
+                                      std::to_string(info.legendLeft), std::to_string(plot.nJets)};
+    parts.insert(parts.end(), info.drawOptions.begin(), info.drawOptions.end());
+
+    std::vector<Double_t> contents;
+    for (TH1* h : plot.copies) {
+        parts.push_back(h->GetName());
+        parts.push_back(h->GetTitle());
+        parts.push_back(h->GetXaxis()->GetTitle());
+        parts.push_back(h->GetYaxis()->GetTitle());
+        parts.push_back(std::to_string(h->GetLineColor()));
+        contents.resize(h->GetNcells());
+        for (Int_t bin = 0; bin < h->GetNcells(); bin++) {
+            contents[bin] = h->GetBinContent(bin);
+        }
+        contents.push_back(h->GetEntries());
+        parts.emplace_back(reinterpret_cast<const char*>(contents.data()), contents.size() * sizeof(Double_t));
+    }
+    return Checkpoint::Signature(parts);
+}
+
+bool PlotRenderer::Exists(const std::string& path) {
+    struct stat st;
+    return stat(path.c_str(), &st) == 0 && S_ISREG(st.st_mode);
+}
+
+bool PlotRenderer::Save(TCanvas* canvas, const std::string& path) {
+    // SaveAs no devuelve si ha podido escribir: se borra la imagen anterior y se comprueba
+    // que la nueva existe
+    std::remove(path.c_str());
+    canvas->SaveAs(path.c_str());
+    if (!Exists(path)) {
+        std::cerr << "Error: no se pudo guardar " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool PlotRenderer::Draw(const Plot& plot, const std::string& plotDir) {
+    if (plot.info->Is2D()) {
+        return DrawPerJet(plot, plotDir);
+    }
+    return DrawOverlay(plot, plotDir);
+}
+
+bool PlotRenderer::DrawOverlay(const Plot& plot, const std::string& plotDir) {
+    const ObservableInfo& info = *plot.info;
+    const std::vector<TH1*>& copies = plot.copies;
+
+    // Todas las copias superpuestas en un canvas
+    TString canvasTitle = (info.scope == kPairScope) ? Form(info.canvasTitle.c_str(), plot.nJets) : info.canvasTitle.c_str();
+    TCanvas* canvas = new TCanvas(("c" + info.name).c_str(), canvasTitle, 600, 400);
+    if (info.logy) gPad->SetLogy(); // Escala logaritmica en el eje y
+    copies[0]->Draw();
+    for (size_t k = 1; k < copies.size(); k++) {
+        copies[k]->Draw("SAME");
+    }
+
+    // Leyenda: jets o parejas de jets (el histograma por evento no la lleva)
+    TLegend* legend = nullptr;
+    if (info.scope == kPairScope) {
+        legend = new TLegend(0.7, 0.55, 0.9, 0.9);
+        legend->SetHeader("DeltaR pares de Jets", "C");
+        for (Int_t i = 0; i < plot.nJets; i++) {
+            for (Int_t j = i + 1; j < plot.nJets; j++) {
+                legend->AddEntry(copies[HistogramSet::PairIndex(i, j, plot.nJets)], Form("Entre %d y %d", i+1, j+1), "l");
+            }
+        }
+    } else if (info.scope != kEventScope) {
+        legend = info.legendLeft ? new TLegend(0.1, 0.7, 0.2, 0.9) : new TLegend(0.8, 0.7, 0.9, 0.9);
+        legend->SetHeader("Jets", "C");
+        for (size_t k = 0; k < copies.size(); k++) {
+            legend->AddEntry(copies[k], Form("Jet %d", (Int_t)k + 1), "l");
+        }
+    }
+    if (legend) legend->Draw();
+
+    bool saved = Save(canvas, plotDir + "/" + plot.files[0]);
+    delete legend;
+    delete canvas;
+    return saved;
+}
+
+bool PlotRenderer::DrawPerJet(const Plot& plot, const std::string& plotDir) {
+    const ObservableInfo& info = *plot.info;
+
+    // Un canvas por jet; los del perfil radial son mas pequenos
+    Int_t width = (info.scope == kPointScope) ? 600 : 800;
+    Int_t height = (info.scope == kPointScope) ? 400 : 600;
+
+    size_t file = 0;
+    bool saved = true;
+    for (TH1* h : plot.copies) {
+        TCanvas* canvas = new TCanvas(Form("c%s", h->GetName()), h->GetTitle(), width, height);
+        gStyle->SetNumberContours(10); // Numero de colores a utilizar
+        gPad->SetLogz(); // Escala logaritmica en el eje z
+
+        // Una imagen por opcion de dibujo (la segunda con prefijo CONT_)
+        for (const auto& option : info.drawOptions) {
+            h->Draw(option.c_str());
+            saved = Save(canvas, plotDir + "/" + plot.files[file++]) && saved;
+        }
+        delete canvas;
+    }
+    return saved;
+}
+
+std::map<std::string, std::string> PlotRenderer::LoadState(const std::string& path) {
+    std::map<std::string, std::string> state;
+    std::ifstream in(path);
+    std::string name, hash;
+    while (in >> name >> hash) {
+        state[name] = hash;
+    }
+    return state;
+}
+
+bool PlotRenderer::SaveState(const std::string& path, const std::map<std::string, std::string>& state) {
+    {
+        std::ofstream out(path + ".tmp");
+        for (const auto& entry : state) {
+            out << entry.first << " " << entry.second << "\n";
+        }
+        if (!out.flush()) {
+            std::cerr << "Error: no se pudo escribir " << path << ".tmp" << std::endl;
+            return false;
+        }
+    }
+    if (std::rename((path + ".tmp").c_str(), path.c_str()) != 0) {
+        std::cerr << "Error: no se pudo escribir " << path << std::endl;
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,53 @@
+#ifndef PLOTRENDERER_H
+#define PLOTRENDERER_H
+
+#include <TFile.h>
+#include <TCanvas.h>
+#include <TH1.h>
+#include <map>
+#include <string>
+#include <vector>
+#include "HistogramRegistry.h"
+
+// Dibujo de los graficos a partir de un histograms.root, separado del analisis: sirve
+// para la salida de un analisis, de una union (--merge) o de ejecuciones anteriores.
+// Los graficos se reparten entre varios procesos (fork) en modo batch de ROOT; cada
+// proceso dibuja los suyos con sus propios canvas.
+//
+// En plotDir/render_state.txt se guarda la huella de cada grafico dibujado (contenido de
+// sus histogramas y estilo): solo se vuelven a dibujar los graficos cuya huella ha cambiado
+// o a los que les falta alguna imagen.
+class PlotRenderer {
+public:
+    // Dibuja los histogramas de input en plotDir con nProcs procesos (force: todos los
+    // graficos); false si no se puede leer input o algun grafico no se ha dibujado
+    static bool Render(const std::string& input, const std::string& plotDir, Int_t nProcs, bool force);
+
+private:
+    // Un grafico: las copias de un observable guardadas en el archivo
+    struct Plot {
+        const ObservableInfo* info;
+        std::vector<TH1*> copies;
+        Int_t nJets;                    // Jets principales (titulo y leyenda de las parejas)
+        std::string hash;               // Huella del contenido y del estilo
+        std::vector<std::string> files; // Imagenes que produce
+    };
+
+    template <class Record>
+    static void Collect(TFile& file, const std::vector<Observable<Record>>& defs, std::vector<Plot>& plots);
+
+    static std::string Hash(const Plot& plot);
+    static bool Exists(const std::string& path);
+
+    // Dibujan el grafico en plotDir; false si alguna imagen no se ha guardado
+    static bool Draw(const Plot& plot, const std::string& plotDir);
+    static bool DrawOverlay(const Plot& plot, const std::string& plotDir);
+    static bool DrawPerJet(const Plot& plot, const std::string& plotDir);
+    static bool Save(TCanvas* canvas, const std::string& path);
+
+    // Huellas de los graficos dibujados, por nombre del observable
+    static std::map<std::string, std::string> LoadState(const std::string& path);
+    static bool SaveState(const std::string& path, const std::map<std::string, std::string>& state);
+};
+
+#endif // PLOTRENDERER_H
@@ -0,0 +1,64 @@
+#ifndef RADIALPROFILE_H
+#define RADIALPROFILE_H
+
+#include <Rtypes.h>
+#include <algorithm>
+
+// Orden por DeltaR de las particulas del cono de un jet, para recorrer el perfil radial
+// de pT (pT acumulado, R50, R95) en una sola pasada. El orden es estable: a igual
+// DeltaR se mantiene el orden de asignacion (indice de traza), asi que el resultado no
+// depende del algoritmo. Pocas particulas: insercion directa. Muchas: reparto estable
+// por DeltaR cuantizado en cubetas y una insercion final sobre el array casi ordenado.
+class RadialProfile {
+public:
+    static constexpr Int_t kSmall = 16;         // Hasta aqui, insercion directa
+    static constexpr Int_t kBuckets = 64;       // Cubetas de DeltaR en [0, kMaxDeltaR)
+    static constexpr Double_t kMaxDeltaR = 0.4; // Radio del cono
+
+    // Ordena n particulas (con miembro deltaR) por DeltaR creciente; scratch debe tener
+    // espacio para n particulas
+    template <class Particle>
+    static void Sort(Particle* particles, Int_t n, Particle* scratch) {
+        if (n > kSmall) {
+            BucketPass(particles, n, scratch);
+        }
+        InsertionSort(particles, n);
+    }
+
+private:
+    template <class Particle>
+    static void InsertionSort(Particle* p, Int_t n) {
+        for (Int_t k = 1; k < n; k++) {
+            Particle x = p[k];
+            Int_t m = k - 1;
+            while (m >= 0 && x.deltaR < p[m].deltaR) {
+                p[m + 1] = p[m];
+                m--;
+            }
+            p[m + 1] = x;
+        }
+    }
+
+    // Reparto estable por cubeta (monotono en DeltaR): deja solo desorden dentro de cada cubeta
+    template <class Particle>
+    static void BucketPass(Particle* p, Int_t n, Particle* scratch) {
+        Int_t start[kBuckets + 1] = {0};
+        for (Int_t k = 0; k < n; k++) {
+            start[Bucket(p[k].deltaR) + 1]++;
+        }
+        for (Int_t b = 0; b < kBuckets; b++) {
+            start[b + 1] += start[b];
+        }
+        for (Int_t k = 0; k < n; k++) {
+            scratch[start[Bucket(p[k].deltaR)]++] = p[k];
+        }
+        std::copy(scratch, scratch + n, p);
+    }
+
+    static Int_t Bucket(Double_t deltaR) {
+        Int_t b = (Int_t)(deltaR * (kBuckets / kMaxDeltaR));
+        return std::min(std::max(b, 0), kBuckets - 1);
+    }
+};
+
+#endif // RADIALPROFILE_H
@@ -0,0 +1,380 @@
+#ifndef RUNOPTIONS_H
+#define RUNOPTIONS_H
+
+#include <Rtypes.h>
+#include <glob.h>
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "AnalyzerConfig.h"
+
+// Opciones de linea de comandos del ejecutable.
+//
+//   Analisis: main [opciones] archivo.root|'patron*.root' ...
+//   Union:    main --merge [-o dir] [-j hilos] parcial1/histograms.root parcial2/histograms.root ...
+//   Dibujo:   main --render [-o dir] [-j procesos] [--plots dir] [--redraw] [--flavor-split]
+//   Muestras: main [opciones] --sample b='b/*.root' --sample light='l/*.root' ... [--rank]
+//   Ranking:  main --rank [-o dir] [-j hilos] senal/histograms.root fondo/histograms.root
+//             main --rank [-o dir] [-j hilos] histograms.root (con --flavor-split: b frente a ligeros)
+//
+// Los patrones se expanden aqui (tambien entre comillas) y se ordenan, asi que todos los
+// trabajos de una muestra ven la misma lista. --shard k/N se queda con el k-esimo de N
+// bloques contiguos de archivos (k = 0..N-1); --entries limita las entradas del TChain.
+struct RunOptions {
+    // Muestra etiquetada del modo comparacion; sus salidas van a <dir>/<etiqueta>
+    struct Sample {
+        std::string label;
+        std::vector<std::string> patterns;
+        std::vector<std::string> inputs; // Archivos, ya expandidos
+    };
+
+    bool merge = false;                  // Modo union de salidas parciales
+    bool render = false;                 // Modo dibujo de <dir>/histograms.root
+    bool rank = false;                   // Clasificar los histogramas por poder de separacion
+    std::vector<std::string> inputs;     // Archivos de entrada, ya expandidos
+    std::vector<Sample> samples;         // Muestras a comparar (vacio: una sola muestra)
+    std::string outputDir = "plots";     // Directorio de histograms.root, graficos y columnas
+    std::string plotDir;                 // Directorio de los graficos (vacio: outputDir)
+    bool redraw = false;                 // Dibujar todos los graficos, tambien los que no han cambiado
+    Int_t nThreads = 0;                  // 0: std::thread::hardware_concurrency()
+    Int_t shard = 0;                     // Bloque de archivos de este trabajo
+    Int_t nShards = 1;                   // Numero de bloques
+    Long64_t firstEntry = 0;             // Primera entrada del TChain
+    Long64_t lastEntry = -1;             // Entrada final (excluida); -1: hasta el final
+    Int_t leadingJets = 4;               // Jets principales por evento (1 a AnalyzerConfig::kMaxLeadingJets)
+    std::vector<std::string> observables;        // Observables a llenar (vacio: todos)
+    std::vector<std::string> disabledObservables; // Observables desactivados
+    Int_t minJets = 1;                   // Preseleccion: jets minimos en las ventanas de pT y eta
+    double jetPtMin = 0;                 // Ventana de pT de la preseleccion: [jetPtMin, jetPtMax)
+    double jetPtMax = 0;                 // (<= 0: sin limite)
+    double jetEtaMax = 0;                // |eta| maximo de la preseleccion (<= 0: sin limite)
+    bool flavorSplit = false;            // Histogramas por jet tambien por sabor (b, c, ligeros)
+    bool selectionCache = true;          // Indices de entradas preseleccionadas
+    std::string selectionCacheDir;       // Directorio de los indices (vacio: <dir>/selection)
+    Int_t readAhead = 0;                 // Lotes de lectura anticipada por hilo (0: sin lector aparte)
+    bool blocks = false;                 // Analizar por lotes de eventos
+    Int_t cacheMB = 0;                   // TTreeCache por hilo en MB (0: el de ROOT)
+    bool ioStats = false;                // Estadisticas de E/S al terminar
+    bool timing = false;                 // Medir tiempos por fase (<dir>/timing.json)
+    bool draw = true;                    // Dibujar los graficos al terminar (en -j procesos)
+    bool exportFeatures = true;          // Exportar las variables por jet (.npy)
+    Long64_t checkpointEvents = 0;       // Punto de control cada N eventos por hilo (0: no)
+    double checkpointSeconds = 0;        // Punto de control cada T segundos por hilo (0: no)
+    bool resume = false;                 // Reanudar desde los puntos de control de <dir>/checkpoint
+    bool incremental = false;            // Procesar solo los archivos nuevos segun <dir>/manifest.txt
+
+    // Puntos de control activados
+    bool Checkpoints() const { return checkpointEvents > 0 || checkpointSeconds > 0 || resume; }
+
+    static void PrintUsage(const char* program) {
+        std::cerr << "Uso: " << program << " [opciones] archivo.root|'patron*.root' ...\n"
+                  << "     " << program << " --merge [-o dir] [-j hilos] histograms.root ...\n"
+                  << "     " << program << " --render [-o dir] [-j procesos] [--plots dir] [--redraw] [--flavor-split]\n"
+                  << "     " << program << " [opciones] --sample etiqueta=patron[,patron...] --sample ... [--rank]\n"
+                  << "     " << program << " --rank [-o dir] [-j hilos] senal/histograms.root fondo/histograms.root\n"
+                  << "     " << program << " --rank [-o dir] [-j hilos] histograms.root\n"
+                  << "Opciones:\n"
+                  << "  -o, --output dir         directorio de salida (por defecto: plots)\n"
+                  << "  -j, --threads n          hilos (por defecto: todos los nucleos)\n"
+                  << "  --shard k/N              procesar el bloque k (0..N-1) de N bloques de archivos\n"
+                  << "  --entries a:b            procesar las entradas [a, b) del TChain (b vacio: hasta el final)\n"
+                  << "  --jets n                 jets principales por evento, de 1 a " << AnalyzerConfig::kMaxLeadingJets
+                  << " (por defecto 4)\n"
+                  << "  --observables h1,h2,...  llenar solo esos histogramas (nombre base, p. ej. hJetPT,hR50_vs_R95)\n"
+                  << "  --disable h1,h2,...      no llenar esos histogramas (tiene prioridad sobre --observables)\n"
+                  << "  --min-jets n             preseleccion: eventos con al menos n jets en las ventanas (por defecto 1)\n"
+                  << "  --jet-pt min[:max]       preseleccion: ventana de pT de los jets (GeV)\n"
+                  << "  --jet-eta max            preseleccion: |eta| maximo de los jets\n"
+                  << "  --selection-cache dir    directorio de los indices de entradas preseleccionadas (por defecto <dir>/selection)\n"
+                  << "  --no-selection-cache     leer todas las entradas, sin indices de seleccion\n"
+                  << "  --flavor-split           histogramas por jet tambien separados en jets b, c y ligeros (Jet.Flavor),\n"
+                  << "                           superpuestos en <plots>/flavors.pdf\n"
+                  << "  --read-ahead n           leer en un hilo aparte, con n lotes de 256 eventos en cola\n"
+                  << "  --blocks                 analizar por lotes de 256 eventos (llenado con FillN)\n"
+                  << "  --cache MB               TTreeCache de MB por hilo con las ramas activas y precarga\n"
+                  << "  --io-stats               lecturas, bytes y eficiencia del cache por archivo al terminar\n"
+                  << "  --timing                 medir tiempos por fase y ritmo; informe en <dir>/timing.json\n"
+                  << "  --no-draw                no dibujar los graficos (se pueden dibujar despues con --render)\n"
+                  << "  --plots dir              directorio de los graficos (por defecto: el de salida)\n"
+                  << "  --redraw                 dibujar todos los graficos, tambien los que no han cambiado\n"
+                  << "  --no-features            no exportar las variables por jet\n"
+                  << "  --checkpoint-events n    guardar un punto de control cada n eventos de cada hilo\n"
+                  << "  --checkpoint-seconds t   guardar un punto de control cada t segundos de cada hilo\n"
+                  << "  --resume                 reanudar desde <dir>/checkpoint (mismos hilos y entradas)\n"
+                  << "  --incremental            procesar solo los archivos que no estan en <dir>/manifest.txt\n"
+                  << "  --merge                  unir histogramas parciales en <dir>/histograms.root\n"
+                  << "  --render                 dibujar los graficos de <dir>/histograms.root y terminar\n"
+                  << "  --sample etiqueta=patron comparar muestras: cada una en <dir>/<etiqueta>, a la vez con los -j hilos,\n"
+                  << "                           y sus histogramas normalizados superpuestos en <plots>/comparison.pdf\n"
+                  << "  --rank                   clasificar los histogramas por su separacion entre senal y fondo\n"
+                  << "                           (con --sample: la primera muestra frente a la segunda; con un solo\n"
+                  << "                           archivo: sus jets b frente a los ligeros) en <dir>/ranking.txt\n";
+    }
+
+    // Devuelve false (tras imprimir el motivo) si los argumentos no son validos
+    bool Parse(int argc, char** argv) {
+        std::vector<std::string> patterns;
+        for (int k = 1; k < argc; k++) {
+            std::string arg = argv[k];
+            // Opciones con valor
+            auto value = [&](std::string& out) {
+                if (k + 1 >= argc) {
+                    std::cerr << "Error: falta el valor de " << arg << std::endl;
+                    return false;
+                }
+                out = argv[++k];
+                return true;
+            };
+            std::string v;
+
+            if (arg == "-h" || arg == "--help") {
+                PrintUsage(argv[0]);
+                return false;
+            } else if (arg == "--merge") {
+                merge = true;
+            } else if (arg == "--render") {
+                render = true;
+            } else if (arg == "--rank") {
+                rank = true;
+            } else if (arg == "--flavor-split") {
+                flavorSplit = true;
+            } else if (arg == "--no-draw") {
+                draw = false;
+            } else if (arg == "--redraw") {
+                redraw = true;
+            } else if (arg == "--plots") {
+                if (!value(plotDir)) return false;
+            } else if (arg == "--sample") {
+                Sample sample;
+                size_t equal;
+                if (!value(v) || (equal = v.find('=')) == std::string::npos || !ValidLabel(sample.label = v.substr(0, equal))) {
+                    return Invalid(arg, v);
+                }
+                SplitList(v.substr(equal + 1), sample.patterns);
+                if (sample.patterns.empty()) return Invalid(arg, v);
+                samples.push_back(sample);
+            } else if (arg == "--observables") {
+                if (!value(v)) return false;
+                SplitList(v, observables);
+                if (observables.empty()) return Invalid(arg, v);
+            } else if (arg == "--disable") {
+                if (!value(v)) return false;
+                SplitList(v, disabledObservables);
+                if (disabledObservables.empty()) return Invalid(arg, v);
+            } else if (arg == "--no-selection-cache") {
+                selectionCache = false;
+            } else if (arg == "--selection-cache") {
+                if (!value(selectionCacheDir)) return false;
+            } else if (arg == "--no-features") {
+                exportFeatures = false;
+            } else if (arg == "--incremental") {
+                incremental = true;
+            } else if (arg == "--resume") {
+                resume = true;
+            } else if (arg == "--checkpoint-events") {
+                if (!value(v) || !ParseLong(v, checkpointEvents) || checkpointEvents < 1) return Invalid(arg, v);
+            } else if (arg == "--checkpoint-seconds") {
+                char* end = nullptr;
+                if (!value(v) || (checkpointSeconds = std::strtod(v.c_str(), &end)) <= 0 || *end != '\0') {
+                    return Invalid(arg, v);
+                }
+            } else if (arg == "-o" || arg == "--output") {
+                if (!value(outputDir)) return false;
+            } else if (arg == "-j" || arg == "--threads") {
+                if (!value(v) || !ParseInt(v, nThreads) || nThreads < 1) return Invalid(arg, v);
+            } else if (arg == "--read-ahead") {
+                if (!value(v) || !ParseInt(v, readAhead) || readAhead < 0) return Invalid(arg, v);
+            } else if (arg == "--cache") {
+                if (!value(v) || !ParseInt(v, cacheMB) || cacheMB < 0) return Invalid(arg, v);
+            } else if (arg == "--io-stats") {
+                ioStats = true;
+            } else if (arg == "--timing") {
+                timing = true;
+            } else if (arg == "--blocks") {
+                blocks = true;
+            } else if (arg == "--jets") {
+                if (!value(v) || !ParseInt(v, leadingJets)) return Invalid(arg, v);
+                // El almacenamiento por jet principal es de tamano fijo
+                if (leadingJets < 1 || leadingJets > AnalyzerConfig::kMaxLeadingJets) {
+                    std::cerr << "Error: --jets admite de 1 a " << AnalyzerConfig::kMaxLeadingJets
+                              << " jets principales: '" << v << "'" << std::endl;
+                    return false;
+                }
+            } else if (arg == "--min-jets") {
+                if (!value(v) || !ParseInt(v, minJets) || minJets < 1) return Invalid(arg, v);
+            } else if (arg == "--jet-pt") {
+                if (!value(v)) return false;
+                size_t colon = v.find(':');
+                if (!ParseDouble(v.substr(0, colon), jetPtMin) || jetPtMin < 0) return Invalid(arg, v);
+                if (colon != std::string::npos && (!ParseDouble(v.substr(colon + 1), jetPtMax) || jetPtMax <= jetPtMin)) {
+                    return Invalid(arg, v);
+                }
+            } else if (arg == "--jet-eta") {
+                if (!value(v) || !ParseDouble(v, jetEtaMax) || jetEtaMax <= 0) return Invalid(arg, v);
+            } else if (arg == "--shard") {
+                size_t slash;
+                if (!value(v) || (slash = v.find('/')) == std::string::npos ||
+                    !ParseInt(v.substr(0, slash), shard) || !ParseInt(v.substr(slash + 1), nShards) ||
+                    nShards < 1 || shard < 0 || shard >= nShards) {
+                    return Invalid(arg, v);
+                }
+            } else if (arg == "--entries") {
+                size_t colon;
+                if (!value(v) || (colon = v.find(':')) == std::string::npos ||
+                    !ParseLong(v.substr(0, colon), firstEntry) || firstEntry < 0) {
+                    return Invalid(arg, v);
+                }
+                std::string last = v.substr(colon + 1);
+                if (!last.empty() && (!ParseLong(last, lastEntry) || lastEntry < firstEntry)) return Invalid(arg, v);
+            } else if (arg.size() > 1 && arg[0] == '-') {
+                std::cerr << "Error: opcion desconocida " << arg << std::endl;
+                PrintUsage(argv[0]);
+                return false;
+            } else {
+                patterns.push_back(arg);
+            }
+        }
+
+        if (plotDir.empty()) plotDir = outputDir;
+        if (render) {
+            // Sin archivos de entrada: se dibuja <dir>/histograms.root
+            if (!patterns.empty() || merge || rank || !samples.empty()) {
+                std::cerr << "Error: --render solo dibuja <dir>/histograms.root" << std::endl;
+                return false;
+            }
+            if (nThreads == 0) nThreads = std::max(1u, std::thread::hardware_concurrency());
+            return true;
+        }
+        if (!samples.empty()) return ParseSamples(patterns);
+        if (rank) {
+            // Histogramas de senal y de fondo ya escritos, o uno con las rebanadas por sabor
+            if (patterns.empty() || patterns.size() > 2 || merge) {
+                std::cerr << "Error: --rank necesita senal/histograms.root fondo/histograms.root o un histograms.root"
+                          << " con --flavor-split" << std::endl;
+                return false;
+            }
+            inputs = patterns;
+            if (nThreads == 0) nThreads = std::max(1u, std::thread::hardware_concurrency());
+            return true;
+        }
+        if (patterns.empty()) {
+            PrintUsage(argv[0]);
+            return false;
+        }
+        if (incremental && (firstEntry != 0 || lastEntry >= 0)) {
+            std::cerr << "Error: --incremental procesa archivos enteros y no admite --entries" << std::endl;
+            return false;
+        }
+        if (!ExpandPatterns(patterns, inputs)) return false;
+        if (nThreads == 0) nThreads = std::max(1u, std::thread::hardware_concurrency());
+
+        // Bloque contiguo de archivos de este trabajo
+        if (!merge && nShards > 1) {
+            Int_t nFiles = inputs.size();
+            if (nShards > nFiles) {
+                std::cerr << "Error: " << nShards << " bloques para " << nFiles << " archivos" << std::endl;
+                return false;
+            }
+            Int_t begin = (Long64_t)shard * nFiles / nShards;
+            Int_t end = (Long64_t)(shard + 1) * nFiles / nShards;
+            inputs = std::vector<std::string>(inputs.begin() + begin, inputs.begin() + end);
+        }
+        return true;
+    }
+
+private:
+    static bool ParseInt(const std::string& s, Int_t& out) {
+        Long64_t value;
+        if (!ParseLong(s, value)) return false;
+        out = value;
+        return true;
+    }
+
+    static bool ParseLong(const std::string& s, Long64_t& out) {
+        if (s.empty()) return false;
+        char* end = nullptr;
+        out = std::strtoll(s.c_str(), &end, 10);
+        return *end == '\0';
+    }
+
+    static bool ParseDouble(const std::string& s, double& out) {
+        if (s.empty()) return false;
+        char* end = nullptr;
+        out = std::strtod(s.c_str(), &end);
+        return *end == '\0';
+    }
+
+    // Agrega a out los elementos no vacios de una lista separada por comas
+    static void SplitList(const std::string& list, std::vector<std::string>& out) {
+        for (size_t begin = 0, end; begin <= list.size(); begin = end + 1) {
+            end = std::min(list.find(',', begin), list.size());
+            if (end > begin) out.push_back(list.substr(begin, end - begin));
+        }
+    }
+
+    static bool Invalid(const std::string& option, const std::string& value) {
+        std::cerr << "Error: valor no valido para " << option << ": '" << value << "'" << std::endl;
+        return false;
+    }
+
+    // Etiquetas de muestra: se usan como nombre de directorio y en las leyendas
+    static bool ValidLabel(const std::string& label) {
+        return !label.empty() && label[0] != '.' && label.find_first_not_of(
+            "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_.-") == std::string::npos;
+    }
+
+    // Modo comparacion: cada muestra procesa sus archivos enteros, sin otros archivos de entrada
+    bool ParseSamples(const std::vector<std::string>& patterns) {
+        if (!patterns.empty() || merge) {
+            std::cerr << "Error: con --sample los archivos de entrada van en cada muestra" << std::endl;
+            return false;
+        }
+        if (samples.size() < 2) {
+            std::cerr << "Error: --sample necesita al menos dos muestras" << std::endl;
+            return false;
+        }
+        if (incremental || nShards > 1 || Checkpoints()) {
+            std::cerr << "Error: --sample no admite --incremental, --shard ni puntos de control" << std::endl;
+            return false;
+        }
+        for (size_t k = 0; k < samples.size(); k++) {
+            for (size_t j = 0; j < k; j++) {
+                if (samples[j].label == samples[k].label) {
+                    std::cerr << "Error: etiqueta de muestra repetida: " << samples[k].label << std::endl;
+                    return false;
+                }
+            }
+            if (!ExpandPatterns(samples[k].patterns, samples[k].inputs)) return false;
+        }
+        if (nThreads == 0) nThreads = std::max(1u, std::thread::hardware_concurrency());
+        return true;
+    }
+
+    // Expande los patrones en orden; cada patron se ordena y debe coincidir con algun archivo.
+    // Las rutas sin comodines (tambien las remotas, root://...) pasan tal cual al TChain
+    static bool ExpandPatterns(const std::vector<std::string>& patterns, std::vector<std::string>& inputs) {
+        for (const auto& pattern : patterns) {
+            if (pattern.find_first_of("*?[") == std::string::npos) {
+                inputs.push_back(pattern);
+                continue;
+            }
+            glob_t matches;
+            int status = glob(pattern.c_str(), 0, nullptr, &matches);
+            if (status != 0) {
+                std::cerr << "Error: ningun archivo coincide con " << pattern << std::endl;
+                globfree(&matches);
+                return false;
+            }
+            for (size_t k = 0; k < matches.gl_pathc; k++) {
+                inputs.push_back(matches.gl_pathv[k]);
+            }
+            globfree(&matches);
+        }
+        return true;
+    }
+};
+
+#endif // RUNOPTIONS_H
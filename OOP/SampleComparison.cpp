@@ -0,0 +1,285 @@
+#include "SampleComparison.h"
+#include "FileSystem.h"
+#include <TLegend.h>
+#include <TROOT.h>
+#include <TStyle.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <thread>
+
+// Colores de los conjuntos superpuestos (las muestras, en el orden de --sample)
+static const Color_t kSampleColors[] = {kBlue, kRed, kGreen + 2, kMagenta + 1, kOrange + 7, kCyan + 2, kBlack, kViolet - 1};
+
+SampleComparison::SampleComparison(const std::string& outputDir) : fOutputDir(outputDir) {
+    // Las muestras se analizan en hilos a la vez desde el principio
+    ROOT::EnableThreadSafety();
+}
+
+SampleComparison::~SampleComparison() {
+    for (auto& sample : fSamples) {
+        delete sample.analyzer;
+    }
+}
+
+void SampleComparison::Add(const std::string& label, const std::vector<std::string>& inputs, const AnalyzerConfig& config) {
+    fSamples.push_back({label, new JetAnalyzer(inputs, config)});
+}
+
+bool SampleComparison::Run(Int_t nThreads) {
+    std::vector<Long64_t> entries;
+    for (const auto& sample : fSamples) {
+        entries.push_back(sample.analyzer->Entries());
+    }
+    std::vector<Int_t> shares = Shares(entries, nThreads);
+
+    // Cada muestra reparte sus hilos entre sus rangos de entradas como en un analisis solo
+    std::vector<std::thread> threads;
+    std::vector<char> done(fSamples.size(), false);
+    for (size_t s = 0; s < fSamples.size(); s++) {
+        std::cout << "Muestra " << fSamples[s].label << ": " << entries[s] << " entradas, " << shares[s] << " hilos"
+                  << std::endl;
+        JetAnalyzer* analyzer = fSamples[s].analyzer;
+        Int_t share = shares[s];
+        char* ok = &done[s];
+        threads.emplace_back([analyzer, share, ok]() { *ok = analyzer->LoopEvents(share); });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return std::find(done.begin(), done.end(), false) == done.end();
+}
+
+std::vector<Int_t> SampleComparison::Shares(const std::vector<Long64_t>& entries, Int_t nThreads) {
+    Int_t nSamples = entries.size();
+    std::vector<Int_t> shares(nSamples, 1);
+    Long64_t total = 0;
+    for (Long64_t n : entries) {
+        total += n;
+    }
+    Int_t spare = nThreads - nSamples;
+    if (spare <= 0 || total <= 0) return shares;
+
+    // Parte entera de la proporcion de cada muestra; los hilos que sobran, a los mayores restos
+    // (a igual resto, a la primera muestra)
+    std::vector<std::pair<Long64_t, Int_t>> remainders;
+    Int_t given = 0;
+    for (Int_t s = 0; s < nSamples; s++) {
+        Long64_t part = entries[s] * spare;
+        shares[s] += part / total;
+        given += part / total;
+        remainders.push_back({part % total, -s});
+    }
+    std::sort(remainders.rbegin(), remainders.rend());
+    for (Int_t k = 0; given < spare; k++, given++) {
+        shares[-remainders[k].second]++;
+    }
+    return shares;
+}
+
+bool SampleComparison::Save() {
+    bool saved = true;
+    for (const auto& sample : fSamples) {
+        saved = sample.analyzer->SaveHistograms(SampleDir(sample.label)) && saved;
+    }
+    return saved;
+}
+
+bool SampleComparison::Draw(const std::string& plotDir, Int_t nProcs, bool redraw) {
+    bool drawn = true;
+    for (const auto& sample : fSamples) {
+        drawn = sample.analyzer->DrawHistograms(SampleDir(sample.label), plotDir + "/" + sample.label, nProcs, redraw) &&
+                drawn;
+    }
+    return drawn;
+}
+
+void SampleComparison::ReportTiming() const {
+    for (const auto& sample : fSamples) {
+        sample.analyzer->ReportTiming();
+    }
+}
+
+bool SampleComparison::CheckSteadyAllocations() const {
+    bool steady = true;
+    for (const auto& sample : fSamples) {
+        steady = sample.analyzer->CheckSteadyAllocations() && steady;
+    }
+    return steady;
+}
+
+bool SampleComparison::Compare(const std::string& plotDir) const {
+    TH1::AddDirectory(kFALSE);
+    std::vector<Source> sources;
+    bool opened = true;
+    for (const auto& sample : fSamples) {
+        std::string path = SampleDir(sample.label) + "/histograms.root";
+        sources.push_back({sample.label, new TFile(path.c_str(), "READ"), ""});
+        if (sources.back().file->IsZombie()) {
+            std::cerr << "Error: no se pudo abrir " << path << std::endl;
+            opened = false;
+        }
+    }
+    bool overlaid = opened && Overlay(sources, plotDir, "comparison");
+
+    for (auto& source : sources) {
+        source.file->Close();
+        delete source.file;
+    }
+    return overlaid;
+}
+
+bool SampleComparison::CompareFlavors(const std::string& input, const std::string& plotDir) {
+    TH1::AddDirectory(kFALSE);
+    TFile file(input.c_str(), "READ");
+    if (file.IsZombie()) {
+        std::cerr << "Error: no se pudo abrir " << input << std::endl;
+        return false;
+    }
+    std::vector<Source> sources;
+    for (Int_t c = 0; c < kFlavorCategories; c++) {
+        sources.push_back({std::string("jets ") + FlavorCategoryName(c), &file, std::string("_") + FlavorCategoryName(c)});
+    }
+    bool overlaid = Overlay(sources, plotDir, "flavors");
+    file.Close();
+    return overlaid;
+}
+
+bool SampleComparison::Overlay(const std::vector<Source>& sources, const std::string& plotDir, const std::string& name) {
+    std::string output = plotDir + "/" + name;
+    if (!MakeDirectory(output)) return false;
+    gROOT->SetBatch(kTRUE);
+    gStyle->SetOptStat(0);
+
+    // Un solo canvas: cada observable es una pagina del PDF ("[" lo abre y "]" lo cierra).
+    // Print no devuelve si ha podido escribir: se borra el PDF anterior y se comprueba que
+    // el nuevo existe
+    std::string pdf = output + ".pdf";
+    std::remove(pdf.c_str());
+    TCanvas page(("c" + name).c_str(), "Comparacion", 1200, 900);
+    page.Print((pdf + "[").c_str());
+    const HistogramRegistry& registry = HistogramRegistry::Default();
+    Int_t pages = ComparePages(sources, registry.eventObservables, page, output);
+    pages += ComparePages(sources, registry.pairObservables, page, output);
+    pages += ComparePages(sources, registry.jetObservables, page, output);
+    pages += ComparePages(sources, registry.pointObservables, page, output);
+    page.Print((pdf + "]").c_str());
+    if (pages == 0) {
+        std::cerr << "Error: ningun observable comun en " << sources.size() << " conjuntos para " << pdf
+                  << std::endl;
+        return false;
+    }
+    if (!IsFile(pdf)) {
+        std::cerr << "Error: no se pudo guardar " << pdf << std::endl;
+        return false;
+    }
+    std::cout << "Comparacion de " << sources.size() << " conjuntos: " << pages << " observables en " << pdf
+              << std::endl;
+    return true;
+}
+
+template <class Record>
+Int_t SampleComparison::ComparePages(const std::vector<Source>& sources, const std::vector<Observable<Record>>& defs,
+                                     TCanvas& page, const std::string& output) {
+    Int_t pages = 0;
+    for (const auto& def : defs) {
+        // Copias de cada fuente; se comparan las que tienen todas
+        std::vector<std::vector<TH1*>> copies(sources.size());
+        size_t nCopies = 0;
+        for (size_t s = 0; s < sources.size(); s++) {
+            for (Int_t k = 0;; k++) {
+                TString name = HistogramSet::CopyName(def, k) + sources[s].suffix;
+                TH1* h = dynamic_cast<TH1*>(sources[s].file->Get(name));
+                if (!h) break;
+                h->SetDirectory(nullptr);
+                copies[s].push_back(h);
+                if (def.scope == kEventScope) break;
+            }
+            nCopies = (s == 0) ? copies[s].size() : std::min(nCopies, copies[s].size());
+        }
+        if (nCopies > 0) {
+            for (auto& sourceCopies : copies) {
+                for (size_t k = nCopies; k < sourceCopies.size(); k++) {
+                    delete sourceCopies[k];
+                }
+                sourceCopies.resize(nCopies);
+            }
+            DrawPage(def, sources, copies, page, output);
+            pages++;
+        }
+        for (auto& sourceCopies : copies) {
+            for (TH1* h : sourceCopies) {
+                delete h;
+            }
+        }
+    }
+    return pages;
+}
+
+void SampleComparison::DrawPage(const ObservableInfo& info, const std::vector<Source>& sources,
+                                const std::vector<std::vector<TH1*>>& copies, TCanvas& page, const std::string& output) {
+    Int_t nSamples = copies.size();
+    Int_t nCopies = copies[0].size();
+    std::vector<TObject*> owned;
+    page.Clear();
+
+    if (info.Is2D()) {
+        // Una fila por copia y una columna por muestra o categoria
+        page.Divide(nSamples, nCopies);
+        for (Int_t k = 0; k < nCopies; k++) {
+            for (Int_t s = 0; s < nSamples; s++) {
+                TVirtualPad* pad = page.cd(k * nSamples + s + 1);
+                pad->SetLogz();
+                TH1* h = Normalized(copies[s][k], s);
+                h->SetTitle(Form("%s (%s)", copies[s][k]->GetTitle(), sources[s].label.c_str()));
+                h->Draw(info.drawOptions[0].c_str());
+                owned.push_back(h);
+            }
+        }
+    } else {
+        // Un panel por copia con las muestras o categorias superpuestas
+        Int_t columns = std::ceil(std::sqrt(nCopies));
+        Int_t rows = (nCopies + columns - 1) / columns;
+        page.Divide(columns, rows);
+        for (Int_t k = 0; k < nCopies; k++) {
+            TVirtualPad* pad = page.cd(k + 1);
+            if (info.logy) pad->SetLogy();
+
+            std::vector<TH1*> normalized;
+            Double_t maximum = 0;
+            for (Int_t s = 0; s < nSamples; s++) {
+                TH1* h = Normalized(copies[s][k], s);
+                h->SetLineColor(kSampleColors[s % (sizeof(kSampleColors) / sizeof(kSampleColors[0]))]);
+                h->SetLineWidth(2);
+                h->GetYaxis()->SetTitle("Fraccion");
+                maximum = std::max(maximum, h->GetMaximum());
+                normalized.push_back(h);
+                owned.push_back(h);
+            }
+
+            TLegend* legend = new TLegend(0.7, 0.75, 0.9, 0.9);
+            owned.push_back(legend);
+            for (Int_t s = 0; s < nSamples; s++) {
+                normalized[s]->SetMaximum(info.logy ? 2 * maximum : 1.15 * maximum);
+                normalized[s]->Draw(s == 0 ? "HIST" : "HIST SAME");
+                legend->AddEntry(normalized[s], sources[s].label.c_str(), "l");
+            }
+            legend->Draw();
+        }
+    }
+
+    page.SaveAs((output + "/" + info.plotName + ".png").c_str());
+    page.Print((output + ".pdf").c_str(), ("Title:" + info.name).c_str());
+    for (TObject* object : owned) {
+        delete object;
+    }
+}
+
+TH1* SampleComparison::Normalized(const TH1* h, Int_t source) {
+    TH1* normalized = static_cast<TH1*>(h->Clone(Form("%s_%d", h->GetName(), source)));
+    normalized->SetDirectory(nullptr);
+    Double_t integral = normalized->Integral();
+    if (integral > 0) normalized->Scale(1.0 / integral);
+    return normalized;
+}
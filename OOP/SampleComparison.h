@@ -0,0 +1,91 @@
+#ifndef SAMPLECOMPARISON_H
+#define SAMPLECOMPARISON_H
+
+#include <TCanvas.h>
+#include <TFile.h>
+#include <TH1.h>
+#include <string>
+#include <vector>
+#include "JetAnalyzer.h"
+
+// Comparacion de varias muestras etiquetadas (p. ej. enriquecida en b frente a ligera) en
+// un solo trabajo. Cada muestra tiene su JetAnalyzer y sus salidas en <dir>/<etiqueta>;
+// las muestras se analizan a la vez, con los hilos del trabajo repartidos entre ellas en
+// proporcion a sus entradas.
+//
+// Compare superpone, para cada observable, los histogramas de todas las muestras
+// normalizados a area unidad: una imagen por observable en <plots>/comparison y todas
+// como paginas de <plots>/comparison.pdf. CompareFlavors hace lo mismo con las rebanadas
+// por sabor (b, c y ligeros) de un solo histograms.root, en <plots>/flavors.
+class SampleComparison {
+public:
+    explicit SampleComparison(const std::string& outputDir);
+    ~SampleComparison();
+
+    // Agrega una muestra; config debe tener sus salidas en SampleDir(label)
+    void Add(const std::string& label, const std::vector<std::string>& inputs, const AnalyzerConfig& config);
+
+    // Directorio de las salidas de una muestra
+    std::string SampleDir(const std::string& label) const { return fOutputDir + "/" + label; }
+
+    // Analiza todas las muestras a la vez con nThreads hilos en total; false si falla alguna
+    bool Run(Int_t nThreads);
+
+    // histograms.root de cada muestra en su directorio; false si falta alguno
+    bool Save();
+
+    // Graficos de cada muestra en plotDir/<etiqueta>, con nProcs procesos; false si falta
+    // alguno
+    bool Draw(const std::string& plotDir, Int_t nProcs, bool redraw);
+
+    // Graficos superpuestos de las muestras guardadas; false si falta alguna o no se
+    // pueden guardar
+    bool Compare(const std::string& plotDir) const;
+
+    // Graficos superpuestos de las rebanadas por sabor de input (config.flavorSplit); false
+    // si no se puede leer input o crear el directorio de los graficos
+    static bool CompareFlavors(const std::string& input, const std::string& plotDir);
+
+    // Resumen de tiempos de cada muestra (con config.timingReport)
+    void ReportTiming() const;
+
+    // JetAnalyzer::CheckSteadyAllocations de todas las muestras
+    bool CheckSteadyAllocations() const;
+
+    // Hilos de cada muestra: al menos uno y el resto en proporcion a sus entradas
+    static std::vector<Int_t> Shares(const std::vector<Long64_t>& entries, Int_t nThreads);
+
+private:
+    struct Sample {
+        std::string label;
+        JetAnalyzer* analyzer;
+    };
+
+    // Histogramas superpuestos: los de file con su nombre de copia seguido de suffix
+    struct Source {
+        std::string label;
+        TFile* file;
+        std::string suffix;
+    };
+
+    // Imagenes en plotDir/<name> y paginas en plotDir/<name>.pdf; false si no se puede
+    // crear plotDir/<name>, si no hay ningun observable comun o si no se escribe el PDF
+    static bool Overlay(const std::vector<Source>& sources, const std::string& plotDir, const std::string& name);
+
+    // Paginas de los observables de defs que tienen todas las fuentes
+    template <class Record>
+    static Int_t ComparePages(const std::vector<Source>& sources, const std::vector<Observable<Record>>& defs,
+                              TCanvas& page, const std::string& output);
+
+    // Una pagina: copies[s][k] es la copia k del observable en la fuente s
+    static void DrawPage(const ObservableInfo& info, const std::vector<Source>& sources,
+                         const std::vector<std::vector<TH1*>>& copies, TCanvas& page, const std::string& output);
+
+    // Copia normalizada a area unidad (sin cambios si esta vacio)
+    static TH1* Normalized(const TH1* h, Int_t source);
+
+    std::string fOutputDir;
+    std::vector<Sample> fSamples;
+};
+
+#endif // SAMPLECOMPARISON_H
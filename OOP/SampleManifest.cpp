@@ -0,0 +1,172 @@
+#include "SampleManifest.h"
+#include "JetColumns.h"
+#include <TFile.h>
+#include <TTree.h>
+#include <sys/stat.h>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+
+SampleManifest::SampleManifest(const std::string& outputDir)
+    : fDir(outputDir), fPath(outputDir + "/manifest.txt") {}
+
+bool SampleManifest::Load() {
+    fSignature.clear();
+    fFiles.clear();
+    fOutputs.clear();
+
+    std::ifstream in(fPath);
+    std::string line;
+    if (!std::getline(in, line) || line != "manifest 1") return false;
+
+    // Una linea por registro; la ruta va al final porque puede tener espacios
+    while (std::getline(in, line)) {
+        std::istringstream fields(line);
+        std::string kind;
+        fields >> kind;
+        if (kind == "signature") {
+            fields >> fSignature;
+        } else if (kind == "output") {
+            OutputRecord output;
+            fields >> output.size >> output.mtime >> output.name;
+            fOutputs.push_back(output);
+        } else if (kind == "file") {
+            FileRecord file;
+            fields >> file.entries >> file.size >> file.uuid;
+            fields.get();
+            std::getline(fields, file.path);
+            fFiles.push_back(file);
+        }
+        if (fields.fail()) return false;
+    }
+    return !fSignature.empty();
+}
+
+bool SampleManifest::Fingerprint(const std::string& path, FileRecord& record) {
+    record.path = path;
+    TFile* file = TFile::Open(path.c_str(), "READ");
+    if (!file) {
+        std::cerr << "Error: no se pudo abrir " << path << std::endl;
+        return false;
+    }
+    record.uuid = file->GetUUID().AsString();
+    record.size = file->GetSize();
+    TTree* tree = nullptr;
+    file->GetObject("Delphes", tree);
+    record.entries = tree ? tree->GetEntries() : -1;
+    delete file;
+    return true;
+}
+
+bool SampleManifest::Stamp(const std::string& path, OutputRecord& record) {
+    struct stat st;
+    if (stat(path.c_str(), &st) != 0) return false;
+    record.size = st.st_size;
+    record.mtime = (Long64_t)st.st_mtim.tv_sec * 1000000000LL + st.st_mtim.tv_nsec;
+    return true;
+}
+
+std::vector<std::string> SampleManifest::Outputs() {
+    std::vector<std::string> outputs = {"histograms.root"};
+    for (const auto& column : JetColumns::Columns()) {
+        outputs.push_back(JetColumns::ColumnPath("jet_features", column.name));
+    }
+    return outputs;
+}
+
+bool SampleManifest::Plan(const std::vector<std::string>& inputs, const std::string& signature,
+                          std::vector<FileRecord>& pending, std::string& reason) {
+    pending.clear();
+    std::vector<FileRecord> current(inputs.size());
+    for (size_t k = 0; k < inputs.size(); k++) {
+        if (!Fingerprint(inputs[k], current[k])) {
+            reason = "no se pudo leer " + inputs[k];
+            pending = current;
+            return false;
+        }
+    }
+
+    // Condiciones para reutilizar el resultado guardado
+    bool reuse = true;
+    if (!Load()) {
+        reason = "no hay un manifiesto valido en " + fDir;
+        reuse = false;
+    } else if (fSignature != signature) {
+        reason = "la configuracion del analisis ha cambiado";
+        reuse = false;
+    }
+    for (size_t k = 0; reuse && k < fOutputs.size(); k++) {
+        OutputRecord now;
+        if (!Stamp(fDir + "/" + fOutputs[k].name, now) || now.size != fOutputs[k].size || now.mtime != fOutputs[k].mtime) {
+            reason = fOutputs[k].name + " no es el registrado en el manifiesto";
+            reuse = false;
+        }
+    }
+
+    std::map<std::string, const FileRecord*> byPath;
+    for (const auto& file : current) {
+        byPath[file.path] = &file;
+    }
+    for (size_t k = 0; reuse && k < fFiles.size(); k++) {
+        auto found = byPath.find(fFiles[k].path);
+        if (found == byPath.end()) {
+            reason = fFiles[k].path + " ya no esta en la muestra";
+            reuse = false;
+        } else if (!found->second->SameContent(fFiles[k])) {
+            reason = fFiles[k].path + " ha cambiado";
+            reuse = false;
+        }
+    }
+
+    if (!reuse) {
+        pending = current;
+        return false;
+    }
+
+    // Solo los archivos que no estan en el manifiesto, en el orden de la entrada
+    std::map<std::string, bool> recorded;
+    for (const auto& file : fFiles) {
+        recorded[file.path] = true;
+    }
+    for (const auto& file : current) {
+        if (!recorded.count(file.path)) pending.push_back(file);
+    }
+    return true;
+}
+
+bool SampleManifest::Commit(const std::vector<FileRecord>& processed, const std::string& signature, bool replace) {
+    if (replace) fFiles.clear();
+    fFiles.insert(fFiles.end(), processed.begin(), processed.end());
+    fSignature = signature;
+
+    fOutputs.clear();
+    for (const auto& name : Outputs()) {
+        OutputRecord output;
+        output.name = name;
+        if (Stamp(fDir + "/" + name, output)) fOutputs.push_back(output);
+    }
+
+    std::string tmpPath = fPath + ".tmp";
+    {
+        std::ofstream out(tmpPath);
+        out << "manifest 1\n"
+            << "signature " << fSignature << "\n";
+        for (const auto& output : fOutputs) {
+            out << "output " << output.size << " " << output.mtime << " " << output.name << "\n";
+        }
+        for (const auto& file : fFiles) {
+            out << "file " << file.entries << " " << file.size << " " << file.uuid << " " << file.path << "\n";
+        }
+        if (!out.flush()) {
+            std::cerr << "Error: no se pudo escribir " << tmpPath << std::endl;
+            return false;
+        }
+    }
+    if (std::rename(tmpPath.c_str(), fPath.c_str()) != 0) {
+        std::cerr << "Error: no se pudo reemplazar " << fPath << std::endl;
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,67 @@
+#ifndef SAMPLEMANIFEST_H
+#define SAMPLEMANIFEST_H
+
+#include <Rtypes.h>
+#include <string>
+#include <vector>
+
+// Manifiesto de un directorio de salida: que archivos de entrada han contribuido a su
+// histograms.root (y las columnas jet_features.*.npy), con sus entradas y su huella, y la
+// huella de las propias salidas. Permite el modo incremental: si solo se han agregado
+// archivos a la muestra, basta con procesar esos y sumar el resultado guardado.
+//
+// La huella de un archivo de entrada es el UUID de su TFile (nuevo cada vez que el
+// archivo se escribe) y su tamano: se obtiene leyendo solo la cabecera, sin recorrer el
+// archivo. Un archivo cambiado o retirado obliga a rehacer toda la muestra, porque el
+// resultado guardado no separa la contribucion de cada archivo.
+class SampleManifest {
+public:
+    struct FileRecord {
+        std::string path;
+        std::string uuid;
+        Long64_t size = -1;    // Bytes del archivo
+        Long64_t entries = -1; // Entradas del arbol Delphes (se procesan todas: [0, entries))
+
+        bool SameContent(const FileRecord& other) const {
+            return uuid == other.uuid && size == other.size && entries == other.entries;
+        }
+    };
+
+    explicit SampleManifest(const std::string& outputDir);
+
+    // Lee outputDir/manifest.txt; false si no existe o no es valido
+    bool Load();
+
+    // Huella de un archivo de entrada
+    static bool Fingerprint(const std::string& path, FileRecord& record);
+
+    // Decide que procesar: true si basta con los archivos de pending (los nuevos) y el
+    // resultado guardado; false si hay que procesar todo (pending = todos, motivo en reason)
+    bool Plan(const std::vector<std::string>& inputs, const std::string& signature,
+              std::vector<FileRecord>& pending, std::string& reason);
+
+    // Registra los archivos procesados (sobre los anteriores, salvo con replace) y la huella
+    // actual de las salidas; se escribe aparte y se reemplaza con rename
+    bool Commit(const std::vector<FileRecord>& processed, const std::string& signature, bool replace);
+
+private:
+    // Salida del directorio con su tamano y fecha de modificacion (ns)
+    struct OutputRecord {
+        std::string name;
+        Long64_t size = -1;
+        Long64_t mtime = -1;
+    };
+
+    static bool Stamp(const std::string& path, OutputRecord& record);
+
+    // Nombres de las salidas que se registran (las que no existen no se registran)
+    static std::vector<std::string> Outputs();
+
+    std::string fDir;
+    std::string fPath;
+    std::string fSignature;
+    std::vector<FileRecord> fFiles;
+    std::vector<OutputRecord> fOutputs;
+};
+
+#endif // SAMPLEMANIFEST_H
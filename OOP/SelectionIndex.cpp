@@ -0,0 +1,106 @@
+#include "SelectionIndex.h"
+#include "Checkpoint.h"
+#include "FileSystem.h"
+#include <unistd.h>
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+bool SelectionIndex::Open(const std::string& dir, const std::string& selection, const std::vector<std::string>& files) {
+    fDir = dir;
+    fFiles.assign(files.size(), File());
+    fEntries = 0;
+    for (size_t k = 0; k < files.size(); k++) {
+        File& file = fFiles[k];
+        if (!SampleManifest::Fingerprint(files[k], file.record) || file.record.entries < 0) {
+            fFiles.clear();
+            return false;
+        }
+        file.offset = fEntries;
+        fEntries += file.record.entries;
+
+        std::string key = Checkpoint::Signature({"selection 1", selection, file.record.uuid,
+                                                 std::to_string(file.record.size), std::to_string(file.record.entries)});
+        file.indexPath = dir + "/" + key + ".sel";
+        file.indexed = Load(file);
+    }
+    return true;
+}
+
+Int_t SelectionIndex::Indexed() const {
+    return std::count_if(fFiles.begin(), fFiles.end(), [](const File& file) { return file.indexed; });
+}
+
+Long64_t SelectionIndex::Next(Long64_t entry) const {
+    // Archivo de la entrada: el ultimo que empieza en entry o antes
+    auto file = std::upper_bound(fFiles.begin(), fFiles.end(), entry,
+                                 [](Long64_t e, const File& f) { return e < f.offset; });
+    if (file != fFiles.begin()) --file;
+    for (; file != fFiles.end(); ++file) {
+        if (!file->indexed) return std::max(entry, file->offset);
+        auto next = std::lower_bound(file->entries.begin(), file->entries.end(), entry - file->offset);
+        if (next != file->entries.end()) return file->offset + *next;
+    }
+    return fEntries;
+}
+
+Int_t SelectionIndex::Save(const std::vector<Long64_t>& selected, Long64_t first, Long64_t last) {
+    Int_t saved = 0;
+    for (File& file : fFiles) {
+        Long64_t end = file.offset + file.record.entries;
+        if (file.indexed || file.offset < first || end > last) continue;
+
+        auto begin = std::lower_bound(selected.begin(), selected.end(), file.offset);
+        auto stop = std::lower_bound(begin, selected.end(), end);
+        file.entries.clear();
+        for (auto it = begin; it != stop; ++it) {
+            file.entries.push_back(*it - file.offset);
+        }
+        // Sin directorio no se guarda ningun indice (el analisis ya ha terminado sin ellos)
+        if (saved == 0 && !MakeDirectory(fDir)) return 0;
+        if (!Write(file)) continue;
+        file.indexed = true;
+        saved++;
+    }
+    return saved;
+}
+
+bool SelectionIndex::Load(File& file) const {
+    // Cabecera de texto y entradas seleccionadas en binario (Long64_t)
+    std::ifstream in(file.indexPath, std::ios::binary);
+    std::string magic;
+    Long64_t entries = -1, selected = -1;
+    if (!(in >> magic >> entries >> selected) || magic != "selection1" || entries != file.record.entries ||
+        selected < 0 || selected > entries || in.get() != '\n') {
+        return false;
+    }
+    file.entries.resize(selected);
+    in.read(reinterpret_cast<char*>(file.entries.data()), selected * sizeof(Long64_t));
+    if (!in || in.peek() != std::ifstream::traits_type::eof()) {
+        file.entries.clear();
+        return false;
+    }
+    return true;
+}
+
+bool SelectionIndex::Write(const File& file) const {
+    // Se escribe aparte y se reemplaza con rename: otros trabajos pueden compartir el directorio
+    std::string tmp = file.indexPath + ".tmp" + std::to_string(getpid());
+    {
+        std::ofstream out(tmp, std::ios::binary);
+        out << "selection1 " << file.record.entries << " " << file.entries.size() << "\n";
+        out.write(reinterpret_cast<const char*>(file.entries.data()), file.entries.size() * sizeof(Long64_t));
+        if (!out.flush()) {
+            std::cerr << "Error: no se pudo escribir " << tmp << std::endl;
+            std::remove(tmp.c_str());
+            return false;
+        }
+    }
+    if (std::rename(tmp.c_str(), file.indexPath.c_str()) != 0) {
+        std::cerr << "Error: no se pudo escribir " << file.indexPath << std::endl;
+        std::remove(tmp.c_str());
+        return false;
+    }
+    return true;
+}
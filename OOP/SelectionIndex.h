@@ -0,0 +1,56 @@
+#ifndef SELECTIONINDEX_H
+#define SELECTIONINDEX_H
+
+#include <Rtypes.h>
+#include <string>
+#include <vector>
+#include "SampleManifest.h"
+
+// Indice persistente de las entradas que pasan la preseleccion, uno por archivo de
+// entrada, en dir/<clave>.sel. La clave resume la definicion de la preseleccion y la
+// huella del archivo (UUID del TFile, tamano y entradas, como en el manifiesto): si el
+// archivo se reescribe o cambia la preseleccion, la clave cambia y el indice no se usa.
+//
+// En los archivos con indice el bucle salta de una entrada seleccionada a la siguiente,
+// sin leer nada del resto. Los archivos sin indice se recorren enteros y su indice se
+// guarda al terminar, si el recorrido los ha cubierto enteros.
+class SelectionIndex {
+public:
+    // Huellas de los archivos del TChain (en su orden) e indices de selection guardados en
+    // dir; false si algun archivo no se puede leer (sin indice)
+    bool Open(const std::string& dir, const std::string& selection, const std::vector<std::string>& files);
+
+    // Entradas del TChain segun las huellas
+    Long64_t Entries() const { return fEntries; }
+
+    // Archivos con indice y total de archivos
+    Int_t Indexed() const;
+    Int_t Files() const { return fFiles.size(); }
+    bool Complete() const { return Indexed() == Files(); }
+
+    // Primera entrada >= entry que hay que leer: en los archivos con indice, la siguiente
+    // seleccionada; en los demas, entry. Entries() si no queda ninguna
+    Long64_t Next(Long64_t entry) const;
+
+    // Guarda el indice de los archivos sin indice contenidos enteros en [first, last) con
+    // las entradas seleccionadas del recorrido (del TChain, en orden). Devuelve cuantos
+    Int_t Save(const std::vector<Long64_t>& selected, Long64_t first, Long64_t last);
+
+private:
+    struct File {
+        SampleManifest::FileRecord record;
+        Long64_t offset = 0;           // Primera entrada del archivo en el TChain
+        std::string indexPath;         // dir/<clave>.sel
+        bool indexed = false;
+        std::vector<Long64_t> entries; // Entradas seleccionadas, locales al archivo
+    };
+
+    bool Load(File& file) const;
+    bool Write(const File& file) const;
+
+    std::string fDir;
+    std::vector<File> fFiles;
+    Long64_t fEntries = 0;
+};
+
+#endif // SELECTIONINDEX_H
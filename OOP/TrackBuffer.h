@@ -0,0 +1,152 @@
+#ifndef TRACKBUFFER_H
+#define TRACKBUFFER_H
+
+#include <TMath.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <vector>
+#if defined(__AVX__)
+#include <immintrin.h>
+#endif
+
+// Trazas de un evento en columnas alineadas (structure of arrays), copiadas
+// directamente de los arrays Track_* del evento. px y py se calculan una sola vez
+// por traza para las sumas vectoriales de pT cargado y neutro. Cada jet principal
+// tiene ademas una fila con el DeltaR^2 a todas las trazas.
+class TrackBuffer {
+public:
+    static constexpr Int_t kAlign = 32;     // Alineacion de las columnas (registro AVX)
+    static constexpr Int_t kWidth = 8;      // Floats por registro AVX
+    static constexpr Float_t kPadEta = 1e4; // Eta de relleno: DeltaR enorme, nunca en el cono
+
+    TrackBuffer()
+        : size(0), capacity(0), pt(nullptr), eta(nullptr), phi(nullptr), px(nullptr), py(nullptr),
+          d0(nullptr), dz(nullptr), fRows(0), fDeltaR2(nullptr), fData(nullptr) {}
+    ~TrackBuffer() { std::free(fData); }
+    TrackBuffer(const TrackBuffer&) = delete;
+    TrackBuffer& operator=(const TrackBuffer&) = delete;
+
+    // Reserva las columnas para al menos maxTracks trazas y maxJets filas de DeltaR^2
+    // (una sola vez por hilo)
+    void Reserve(Int_t maxTracks, Int_t maxJets) {
+        Int_t padded = Padded(maxTracks);
+        if (padded <= capacity && maxJets <= fRows) return;
+        std::free(fData);
+        capacity = std::max(padded, capacity);
+        fRows = std::max(maxJets, fRows);
+        fData = static_cast<Float_t*>(std::aligned_alloc(kAlign, (kColumns + fRows) * capacity * sizeof(Float_t)));
+        pt = fData;
+        eta = pt + capacity;
+        phi = eta + capacity;
+        px = phi + capacity;
+        py = px + capacity;
+        d0 = py + capacity;
+        dz = d0 + capacity;
+        fDeltaR2 = dz + capacity;
+        charge.resize(capacity);
+    }
+
+    // Copia las trazas del evento actual y rellena hasta un multiplo de kWidth
+    void Fill(Int_t nTracks, const Float_t* trackPT, const Float_t* trackEta, const Float_t* trackPhi,
+              const Int_t* trackCharge, const Float_t* trackD0, const Float_t* trackDZ) {
+        size = nTracks;
+        std::memcpy(pt, trackPT, nTracks * sizeof(Float_t));
+        std::memcpy(eta, trackEta, nTracks * sizeof(Float_t));
+        std::memcpy(phi, trackPhi, nTracks * sizeof(Float_t));
+        std::memcpy(d0, trackD0, nTracks * sizeof(Float_t));
+        std::memcpy(dz, trackDZ, nTracks * sizeof(Float_t));
+        std::memcpy(charge.data(), trackCharge, nTracks * sizeof(Int_t));
+        for (Int_t j = 0; j < nTracks; j++) {
+            px[j] = pt[j] * std::cos(phi[j]);
+            py[j] = pt[j] * std::sin(phi[j]);
+        }
+        for (Int_t j = nTracks; j < Padded(nTracks); j++) {
+            pt[j] = px[j] = py[j] = phi[j] = 0;
+            eta[j] = kPadEta;
+        }
+    }
+
+    // DeltaR^2 entre el eje (jetEta, jetPhi) y todas las trazas, con DeltaPhi en [-pi, pi]
+    void ComputeDeltaR2(Float_t jetEta, Float_t jetPhi, Float_t* out) const {
+        const Float_t pi = TMath::Pi();
+        const Float_t twoPi = TMath::TwoPi();
+        Int_t j = 0;
+#if defined(__AVX__)
+        const __m256 vEta = _mm256_set1_ps(jetEta);
+        const __m256 vPhi = _mm256_set1_ps(jetPhi);
+        const __m256 vPi = _mm256_set1_ps(pi);
+        const __m256 vMinusPi = _mm256_set1_ps(-pi);
+        const __m256 vTwoPi = _mm256_set1_ps(twoPi);
+        for (; j < size; j += kWidth) {
+            __m256 dEta = _mm256_sub_ps(_mm256_load_ps(eta + j), vEta);
+            __m256 dPhi = _mm256_sub_ps(_mm256_load_ps(phi + j), vPhi);
+            dPhi = _mm256_sub_ps(dPhi, _mm256_and_ps(_mm256_cmp_ps(dPhi, vPi, _CMP_GT_OQ), vTwoPi));
+            dPhi = _mm256_add_ps(dPhi, _mm256_and_ps(_mm256_cmp_ps(dPhi, vMinusPi, _CMP_LT_OQ), vTwoPi));
+#if defined(__FMA__)
+            _mm256_store_ps(out + j, _mm256_fmadd_ps(dPhi, dPhi, _mm256_mul_ps(dEta, dEta)));
+#else
+            _mm256_store_ps(out + j, _mm256_add_ps(_mm256_mul_ps(dEta, dEta), _mm256_mul_ps(dPhi, dPhi)));
+#endif
+        }
+#endif
+        for (; j < size; j++) {
+            out[j] = DeltaR2(eta[j], phi[j], jetEta, jetPhi, pi, twoPi);
+        }
+    }
+
+    // DeltaR^2 solo para las trazas candidatas (de EtaPhiGrid); el resto queda fuera del cono
+    void ComputeDeltaR2(Float_t jetEta, Float_t jetPhi, const Int_t* candidates, Int_t nCandidates, Float_t* out) const {
+        const Float_t pi = TMath::Pi();
+        const Float_t twoPi = TMath::TwoPi();
+        std::fill(out, out + size, std::numeric_limits<Float_t>::infinity());
+        for (Int_t k = 0; k < nCandidates; k++) {
+            Int_t j = candidates[k];
+            out[j] = DeltaR2(eta[j], phi[j], jetEta, jetPhi, pi, twoPi);
+        }
+    }
+
+    // Fila de DeltaR^2 del jet principal i
+    Float_t* DeltaR2(Int_t i) const { return fDeltaR2 + i * capacity; }
+
+    static Int_t Padded(Int_t n) { return (n + kWidth - 1) / kWidth * kWidth; }
+
+    Int_t size;
+    Int_t capacity;
+    Float_t* pt;
+    Float_t* eta;
+    Float_t* phi;
+    Float_t* px;
+    Float_t* py;
+    Float_t* d0;
+    Float_t* dz;
+    std::vector<Int_t> charge;
+
+private:
+    static constexpr Int_t kColumns = 7;
+
+    static Float_t DeltaR2(Float_t trackEta, Float_t trackPhi, Float_t jetEta, Float_t jetPhi,
+                           Float_t pi, Float_t twoPi) {
+        Float_t dEta = trackEta - jetEta;
+        Float_t dPhi = trackPhi - jetPhi;
+        dPhi = (dPhi > pi) ? dPhi - twoPi : dPhi;
+        dPhi = (dPhi < -pi) ? dPhi + twoPi : dPhi;
+        // La suma se redondea igual que en el kernel AVX: con FMA el compilador podria
+        // fusionarla o no, y las trazas en el borde del cono cambiarian de jet segun el camino
+#if defined(__FMA__)
+        return std::fma(dPhi, dPhi, dEta * dEta);
+#else
+        Float_t dEta2 = dEta * dEta;
+        Float_t dPhi2 = dPhi * dPhi;
+        return dEta2 + dPhi2;
+#endif
+    }
+
+    Int_t fRows;
+    Float_t* fDeltaR2;
+    Float_t* fData;
+};
+
+#endif // TRACKBUFFER_H
@@ -1,24 +1,181 @@
 #include "JetAnalyzer.cpp"
+#include "HistogramMerger.cpp"
+#include "SampleManifest.cpp"
+#include "SampleComparison.cpp"
+#include "DiscriminationRanking.cpp"
+#include "RunOptions.h"
 
-int main() {
-    // Lista de archivos de entrada
-    std::vector<std::string> inputFiles = {
-        "/home/juan/Btagginghep/rootfiles/Nose/tag_1_delphes_events.root"
-    };
+// Configuracion del analisis con las salidas en outputDir
+static AnalyzerConfig MakeConfig(const RunOptions& options, const std::string& outputDir) {
+    AnalyzerConfig config;
+    config.leadingJets = options.leadingJets;
+    config.observables = options.observables;
+    config.disabledObservables = options.disabledObservables;
+    config.preselection.minJets = options.minJets;
+    config.preselection.jetPtMin = options.jetPtMin;
+    config.preselection.jetPtMax = options.jetPtMax;
+    config.preselection.jetEtaMax = options.jetEtaMax;
+    config.flavorSplit = options.flavorSplit;
+    // Indices de entradas preseleccionadas, compartibles entre ejecuciones
+    if (options.selectionCache) {
+        config.selectionCacheDir = options.selectionCacheDir.empty() ? outputDir + "/selection"
+                                                                     : options.selectionCacheDir;
+    }
+    config.readAhead = options.readAhead;
+    config.eventBlocks = options.blocks;
+    config.treeCacheMB = options.cacheMB;
+    config.ioStats = options.ioStats;
+    if (options.timing) config.timingReport = outputDir + "/timing.json";
+    config.firstEntry = options.firstEntry;
+    config.lastEntry = options.lastEntry;
+    // Exportar las variables por jet para el entrenamiento
+    if (options.exportFeatures) config.featureFile = outputDir + "/jet_features";
+    // Puntos de control periodicos y reanudacion tras una interrupcion
+    if (options.Checkpoints()) {
+        config.checkpointDir = outputDir + "/checkpoint";
+        config.checkpointEvents = options.checkpointEvents;
+        config.checkpointSeconds = options.checkpointSeconds;
+        config.resume = options.resume;
+    }
+    return config;
+}
+
+int main(int argc, char** argv) {
+    RunOptions options;
+    if (!options.Parse(argc, argv)) return 1;
+
+    // Modo union: sumar las salidas parciales de varios trabajos
+    if (options.merge) {
+        bool merged = HistogramMerger::Merge(options.inputs, options.outputDir + "/histograms.root", options.nThreads);
+        return merged ? 0 : 1;
+    }
+
+    // Clasificacion de los histogramas de senal y fondo ya escritos
+    if (options.rank && options.samples.empty()) {
+        std::string output = options.outputDir + "/ranking.txt";
+        bool ranked = (options.inputs.size() == 1)
+                          ? DiscriminationRanking::RunFlavors(options.inputs[0], output, options.nThreads)
+                          : DiscriminationRanking::Run(options.inputs[0], options.inputs[1], output, options.nThreads);
+        return ranked ? 0 : 1;
+    }
+
+    // Modo dibujo: los graficos de una salida ya escrita, sin leer los datos
+    if (options.render) {
+        bool drawn = PlotRenderer::Render(options.outputDir + "/histograms.root", options.plotDir, options.nThreads,
+                                          options.redraw);
+        if (drawn && options.flavorSplit) {
+            drawn = SampleComparison::CompareFlavors(options.outputDir + "/histograms.root", options.plotDir);
+        }
+        return drawn ? 0 : 1;
+    }
+
+    // Modo comparacion: todas las muestras en un trabajo, cada una en <dir>/<etiqueta>
+    if (!options.samples.empty()) {
+        SampleComparison comparison(options.outputDir);
+        for (const auto& sample : options.samples) {
+            comparison.Add(sample.label, sample.inputs, MakeConfig(options, comparison.SampleDir(sample.label)));
+        }
+        if (!comparison.Run(options.nThreads) || !comparison.Save()) return 1;
+        // Los graficos que fallan no detienen el resto, pero el trabajo termina con error
+        bool drawn = !options.draw || comparison.Draw(options.plotDir, options.nThreads, options.redraw);
+        if (options.draw && options.flavorSplit) {
+            for (const auto& sample : options.samples) {
+                drawn = SampleComparison::CompareFlavors(comparison.SampleDir(sample.label) + "/histograms.root",
+                                                         options.plotDir + "/" + sample.label) &&
+                        drawn;
+            }
+        }
+        bool compared = comparison.Compare(options.plotDir);
+        // La primera muestra como senal y la segunda como fondo
+        if (compared && options.rank) {
+            compared = DiscriminationRanking::Run(
+                comparison.SampleDir(options.samples[0].label) + "/histograms.root",
+                comparison.SampleDir(options.samples[1].label) + "/histograms.root",
+                options.outputDir + "/ranking.txt", options.nThreads);
+        }
+        comparison.ReportTiming();
+        bool steady = comparison.CheckSteadyAllocations();
+        if (!drawn || !compared || !steady) return 1;
+        std::cout << "El análisis ha finalizado correctamente." << std::endl;
+        return 0;
+    }
+
+    AnalyzerConfig config = MakeConfig(options, options.outputDir);
+
+    if (options.nShards > 1) {
+        std::cout << "Bloque " << options.shard << "/" << options.nShards << ": "
+                  << options.inputs.size() << " archivos" << std::endl;
+    }
+
+    // Archivos a procesar: todos o, en modo incremental, solo los que no estan en el manifiesto.
+    // El manifiesto solo se escribe si se procesan los archivos enteros
+    SampleManifest manifest(options.outputDir);
+    std::vector<std::string> parts = {"leadingJets=" + std::to_string(config.leadingJets),
+                                      "featureFile=" + config.featureFile};
+    if (!config.preselection.Describe().empty()) parts.push_back(config.preselection.Describe());
+    if (config.flavorSplit) parts.push_back("flavorSplit");
+    // Las exportaciones de otro formato no admiten filas agregadas
+    if (!config.featureFile.empty()) parts.push_back(std::string("featureFormat=") + JetColumns::kFormat);
+    for (const auto& name : config.observables) parts.push_back("+" + name);
+    for (const auto& name : config.disabledObservables) parts.push_back("-" + name);
+    std::string signature = Checkpoint::Signature(parts);
+    std::vector<SampleManifest::FileRecord> records;
+    std::vector<std::string> inputs = options.inputs;
+    bool wholeFiles = options.firstEntry == 0 && options.lastEntry < 0;
+    bool append = false;
+    if (options.incremental) {
+        std::string reason;
+        append = manifest.Plan(options.inputs, signature, records, reason);
+        if (!append) {
+            std::cout << "Modo incremental: se procesa toda la muestra (" << reason << ")" << std::endl;
+        } else if (records.empty()) {
+            std::cout << "Modo incremental: no hay archivos nuevos en la muestra" << std::endl;
+            return 0;
+        } else {
+            std::cout << "Modo incremental: " << records.size() << " archivos nuevos de " << options.inputs.size() << std::endl;
+        }
+        inputs.clear();
+        for (const auto& record : records) {
+            inputs.push_back(record.path);
+        }
+    } else if (wholeFiles) {
+        records.resize(inputs.size());
+        for (size_t k = 0; k < inputs.size() && wholeFiles; k++) {
+            wholeFiles = SampleManifest::Fingerprint(inputs[k], records[k]);
+        }
+    }
+    config.appendFeatures = append;
 
     // Crear instancia de JetAnalyzer
-    JetAnalyzer analyzer(inputFiles);
+    JetAnalyzer analyzer(inputs, config);
+
+    // Procesar eventos en paralelo, un rango de entradas por hilo
+    if (!analyzer.LoopEvents(options.nThreads)) return 1;
+
+    // En modo incremental, sumar el resultado guardado
+    if (append && !analyzer.AddStoredHistograms(options.outputDir + "/histograms.root")) return 1;
+
+    // Guardar histogramas y registrar los archivos que han contribuido
+    if (!analyzer.SaveHistograms(options.outputDir)) return 1;
+    if (wholeFiles) manifest.Commit(records, signature, !append);
 
-    // Procesar eventos
-    analyzer.LoopEvents();
+    // Dibujar histogramas; si falla algun grafico, el resultado ya esta guardado pero el
+    // trabajo termina con error
+    bool drawn = !options.draw ||
+                 analyzer.DrawHistograms(options.outputDir, options.plotDir, options.nThreads, options.redraw);
+    // Jets b, c y ligeros superpuestos
+    if (options.draw && options.flavorSplit) {
+        drawn = SampleComparison::CompareFlavors(options.outputDir + "/histograms.root", options.plotDir) && drawn;
+    }
 
-    // Dibujar histogramas
-    analyzer.DrawHistograms();
+    // Tiempos por fase, incluidos el dibujo y la escritura
+    analyzer.ReportTiming();
 
-    // Guardar histogramas
-    analyzer.SaveHistograms("plots");
+    // Compilacion de comprobacion (BTAG_COUNT_ALLOCS): sin reservas tras el primer evento
+    bool steady = analyzer.CheckSteadyAllocations();
+    if (!drawn || !steady) return 1;
 
     std::cout << "El análisis ha finalizado correctamente." << std::endl;
 
     return 0;
-}
\ No newline at end of file
+}
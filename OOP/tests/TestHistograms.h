@@ -0,0 +1,114 @@
+#ifndef TESTHISTOGRAMS_H
+#define TESTHISTOGRAMS_H
+
+// Utilidades de las pruebas de HistogramSet: registros de variables sinteticos y
+// comparacion exacta de histogramas
+#include "../HistogramMerger.h"
+#include "../HistogramRegistry.h"
+#include <TFile.h>
+#include <cstdio>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <random>
+#include <string>
+
+// Jet principal sintetico: uno de cada 7 sin trazas en el cono (sumPT = 0, sin perfil
+// radial), uno de cada 5 de los demas sin pT parcial (totalPT = 0, sin fracciones) y de
+// sabor b, c, ligero o sin asignar. Los rangos sobrepasan los ejes para llenar tambien
+// los desbordamientos
+inline JetFeatures MakeJet(Int_t index, std::mt19937& rng) {
+    std::uniform_real_distribution<Double_t> u(0, 1);
+    const Double_t nan = std::numeric_limits<Double_t>::quiet_NaN();
+    JetFeatures f = {};
+    f.index = index;
+    f.pt = 230 * u(rng);
+    f.eta = -6 + 12 * u(rng);
+    f.phi = -3.5 + 7 * u(rng);
+    f.nCharged = rng() % 30;
+    f.nNeutrals = rng() % 30;
+    bool tracks = rng() % 7 != 0;
+    bool total = tracks && rng() % 5 != 0;
+    f.sumPT = tracks ? 1 + 100 * u(rng) : 0;
+    f.totalPT = total ? f.sumPT + 50 * u(rng) : 0;
+    if (tracks) {
+        f.averagePT = 70 * u(rng);
+        f.particlesBelowAvgPT = rng() % 130;
+        f.particlesAboveAvgPT = rng() % 70;
+        f.maxPTRatio = 4 * u(rng);
+        f.minPTRatio = u(rng);
+        f.maxDRRatio = 3 * u(rng);
+        f.minDRRatio = 3 * u(rng);
+        f.deltaRMaxPT = 0.45 * u(rng);
+        f.deltaRMinPT = 0.45 * u(rng);
+        f.deltaRMaxDR = 0.45 * u(rng);
+        f.deltaRMinDR = 0.45 * u(rng);
+        f.ptDifference = 220 * u(rng);
+    }
+    f.chargedPTFraction = total ? u(rng) : nan;
+    f.neutralPTFraction = total ? 1 - f.chargedPTFraction : nan;
+    f.r50 = tracks ? 0.4 * u(rng) : nan;
+    f.r95 = tracks ? f.r50 + 0.05 * u(rng) : nan;
+    static const UInt_t flavors[] = {0, 1, 4, 5, 21};
+    f.flavor = flavors[rng() % 5];
+    f.btag = rng() % 2;
+    f.category = FlavorCategoryOf(f.flavor);
+    return f;
+}
+
+// Particula del perfil radial de un jet de la categoria category
+inline RadialPoint MakePoint(Int_t category, std::mt19937& rng) {
+    std::uniform_real_distribution<Double_t> u(0, 1);
+    return {0.45 * u(rng), u(rng), -5 + 10 * u(rng), -5 + 10 * u(rng), category};
+}
+
+// Histogramas de set tal como los escribe Write, leidos de vuelta de path
+inline bool ReadBack(const HistogramSet& set, const std::string& path, HistogramMerger::HistogramList& histograms) {
+    {
+        TFile file(path.c_str(), "RECREATE");
+        bool written = !file.IsZombie() && set.Write();
+        file.Close();
+        if (!written) {
+            std::cerr << "Error: no se pudo escribir " << path << std::endl;
+            return false;
+        }
+    }
+    bool read = HistogramMerger::Read(path, histograms);
+    std::remove(path.c_str());
+    return read;
+}
+
+// Diferencias entre dos listas de histogramas emparejados por nombre: histogramas que
+// faltan, entradas y contenido de cada celda (desbordamientos incluidos), sin tolerancia
+inline Long64_t CountDifferences(const HistogramMerger::HistogramList& a, const HistogramMerger::HistogramList& b,
+                                 const std::string& what) {
+    std::map<std::string, const TH1*> byName;
+    for (const TH1* h : b) {
+        byName[h->GetName()] = h;
+    }
+    Long64_t differences = (a.size() == b.size()) ? 0 : 1;
+    if (differences) std::cerr << "Error: " << what << ": " << a.size() << " y " << b.size() << " histogramas" << std::endl;
+    for (const TH1* h : a) {
+        auto found = byName.find(h->GetName());
+        if (found == byName.end()) {
+            std::cerr << "Error: " << what << ": falta " << h->GetName() << std::endl;
+            differences++;
+            continue;
+        }
+        const TH1* other = found->second;
+        bool same = h->GetNcells() == other->GetNcells() && h->GetEntries() == other->GetEntries();
+        for (Int_t bin = 0; same && bin < h->GetNcells(); bin++) {
+            same = h->GetBinContent(bin) == other->GetBinContent(bin);
+        }
+        if (!same) {
+            if (differences < 10) {
+                std::cerr << "Error: " << what << ": " << h->GetName() << " distinto (" << h->GetEntries() << " y "
+                          << other->GetEntries() << " entradas)" << std::endl;
+            }
+            differences++;
+        }
+    }
+    return differences;
+}
+
+#endif // TESTHISTOGRAMS_H
@@ -0,0 +1,171 @@
+// Microbenchmark de la asignacion de trazas al cono de los jets principales, por numero de
+// trazas del evento:
+//   - objetos: un TLorentzVector por traza y DeltaR con cada jet (el camino anterior a
+//     TrackBuffer)
+//   - denso: columnas de TrackBuffer y DeltaR^2 de cada jet con todas las trazas
+//   - rejilla: EtaPhiGrid y DeltaR^2 solo de las trazas de las celdas vecinas
+// Los tres terminan con la misma pasada de asignacion (suma de pT en el cono). Para 4 y 8
+// jets se muestra el numero de trazas a partir del cual la rejilla es mas rapida que el
+// kernel denso en todos los tamanos medidos (en ninguno hasta ahora, por eso
+// JetAnalyzer::MatchTracks solo usa el kernel denso).
+#include "../EtaPhiGrid.h"
+#include "../EventArena.h"
+#include "../TrackBuffer.h"
+#include <TLorentzVector.h>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+static constexpr Float_t kConeR2 = 0.4f * 0.4f; // Como en JetAnalyzer
+static constexpr Int_t kMaxJets = 8;            // Jets principales como maximo
+static constexpr Int_t kPool = 64;              // Eventos distintos por tamano
+static constexpr Int_t kRepeats = 3;            // Se toma la medida mas rapida
+
+struct Event {
+    std::vector<Float_t> pt, eta, phi, mass, d0, dz;
+    std::vector<Int_t> charge;
+    Int_t nJets;
+    Float_t jetEta[kMaxJets], jetPhi[kMaxJets], jetPT[kMaxJets], jetMass[kMaxJets];
+};
+
+static Event MakeEvent(Int_t nTracks, Int_t nJets, std::mt19937& rng) {
+    // Trazas en la aceptancia del detector de trazas
+    std::uniform_real_distribution<Float_t> eta(-2.5f, 2.5f);
+    std::uniform_real_distribution<Float_t> phi(-TMath::Pi(), TMath::Pi());
+    std::exponential_distribution<Float_t> pt(0.5f);
+    Event e;
+    for (Int_t j = 0; j < nTracks; j++) {
+        e.pt.push_back(0.5f + pt(rng));
+        e.eta.push_back(eta(rng));
+        e.phi.push_back(phi(rng));
+        e.mass.push_back(0.13957f);
+        e.d0.push_back(0);
+        e.dz.push_back(0);
+        e.charge.push_back(j % 2 ? 1 : -1);
+    }
+    e.nJets = nJets;
+    for (Int_t i = 0; i < nJets; i++) {
+        e.jetEta[i] = eta(rng);
+        e.jetPhi[i] = phi(rng);
+        e.jetPT[i] = 30 + 10 * pt(rng);
+        e.jetMass[i] = 5;
+    }
+    return e;
+}
+
+// Suma de pT en el cono a partir de las filas de DeltaR^2 (comun a denso y rejilla)
+static Double_t Assign(const TrackBuffer& tracks, Int_t nJets) {
+    Double_t sum = 0;
+    for (Int_t j = 0; j < tracks.size; j++) {
+        for (Int_t i = 0; i < nJets; i++) {
+            if (tracks.DeltaR2(i)[j] < kConeR2) sum += tracks.pt[j];
+        }
+    }
+    return sum;
+}
+
+static Double_t MatchObjects(const Event& e, std::vector<TLorentzVector>& particles) {
+    Int_t n = e.pt.size();
+    particles.resize(n);
+    for (Int_t j = 0; j < n; j++) {
+        particles[j].SetPtEtaPhiM(e.pt[j], e.eta[j], e.phi[j], e.mass[j]);
+    }
+    Double_t sum = 0;
+    for (Int_t i = 0; i < e.nJets; i++) {
+        TLorentzVector jet;
+        jet.SetPtEtaPhiM(e.jetPT[i], e.jetEta[i], e.jetPhi[i], e.jetMass[i]);
+        for (Int_t j = 0; j < n; j++) {
+            if (jet.DeltaR(particles[j]) < 0.4) sum += particles[j].Pt();
+        }
+    }
+    return sum;
+}
+
+static Double_t MatchDense(const Event& e, TrackBuffer& tracks) {
+    tracks.Fill(e.pt.size(), e.pt.data(), e.eta.data(), e.phi.data(), e.charge.data(), e.d0.data(), e.dz.data());
+    for (Int_t i = 0; i < e.nJets; i++) {
+        tracks.ComputeDeltaR2(e.jetEta[i], e.jetPhi[i], tracks.DeltaR2(i));
+    }
+    return Assign(tracks, e.nJets);
+}
+
+static Double_t MatchGrid(const Event& e, TrackBuffer& tracks, EtaPhiGrid& grid, EventArena& arena) {
+    tracks.Fill(e.pt.size(), e.pt.data(), e.eta.data(), e.phi.data(), e.charge.data(), e.d0.data(), e.dz.data());
+    arena.Reset();
+    grid.Build(tracks.size, tracks.eta, tracks.phi, arena);
+    Int_t* candidates = arena.Allocate<Int_t>(tracks.size);
+    for (Int_t i = 0; i < e.nJets; i++) {
+        Int_t nCandidates = grid.Query(e.jetEta[i], e.jetPhi[i], candidates);
+        tracks.ComputeDeltaR2(e.jetEta[i], e.jetPhi[i], candidates, nCandidates, tracks.DeltaR2(i));
+    }
+    return Assign(tracks, e.nJets);
+}
+
+// ns por evento de match sobre los eventos de pool (la repeticion mas rapida)
+template <class Match>
+static Double_t Time(const std::vector<Event>& pool, Long64_t events, Match match, Double_t& sink) {
+    Double_t best = 0;
+    for (Int_t r = 0; r < kRepeats; r++) {
+        auto start = std::chrono::steady_clock::now();
+        for (Long64_t k = 0; k < events; k++) {
+            sink += match(pool[k % pool.size()]);
+        }
+        Double_t ns = std::chrono::duration<Double_t, std::nano>(std::chrono::steady_clock::now() - start).count();
+        if (r == 0 || ns < best) best = ns;
+    }
+    return best / events;
+}
+
+int main() {
+    const Int_t sizes[] = {32, 64, 100, 163, 256, 512, 1024, 2048, 4096, 8192};
+    const Int_t jetCounts[] = {4, kMaxJets};
+    const Int_t maxTracks = 8192;
+    std::mt19937 rng(2024);
+
+    TrackBuffer tracks;
+    EventArena arena;
+    EtaPhiGrid grid;
+    tracks.Reserve(maxTracks, kMaxJets);
+    arena.Reserve(3 * EventArena::Bytes<Int_t>(maxTracks));
+    std::vector<TLorentzVector> particles;
+    particles.reserve(maxTracks);
+
+    Double_t sink = 0;
+    for (Int_t nJets : jetCounts) {
+        std::cout << "Asignacion de trazas a " << nJets << " jets, ns por evento" << std::endl;
+        std::cout << std::setw(8) << "trazas" << std::setw(12) << "objetos" << std::setw(12) << "denso" << std::setw(12)
+                  << "rejilla" << std::setw(16) << "objetos/denso" << std::setw(16) << "denso/rejilla" << std::endl;
+
+        Int_t threshold = -1; // Menor tamano desde el que la rejilla siempre gana
+        for (Int_t n : sizes) {
+            std::vector<Event> pool;
+            for (Int_t k = 0; k < kPool; k++) {
+                pool.push_back(MakeEvent(n, nJets, rng));
+            }
+            // Un millon de trazas por medida
+            Long64_t events = std::max<Long64_t>(1000000 / n, kPool);
+
+            Double_t objects = Time(pool, events, [&](const Event& e) { return MatchObjects(e, particles); }, sink);
+            Double_t dense = Time(pool, events, [&](const Event& e) { return MatchDense(e, tracks); }, sink);
+            Double_t gridded = Time(pool, events, [&](const Event& e) { return MatchGrid(e, tracks, grid, arena); }, sink);
+
+            std::cout << std::fixed << std::setprecision(1) << std::setw(8) << n << std::setw(12) << objects
+                      << std::setw(12) << dense << std::setw(12) << gridded << std::setprecision(2) << std::setw(16)
+                      << objects / dense << std::setw(16) << dense / gridded << std::endl;
+            if (gridded < dense) {
+                if (threshold < 0) threshold = n;
+            } else {
+                threshold = -1;
+            }
+        }
+
+        if (threshold > 0) {
+            std::cout << "La rejilla es mas rapida desde " << threshold << " trazas" << std::endl;
+        } else {
+            std::cout << "La rejilla no es mas rapida que el kernel denso en ningun tamano medido" << std::endl;
+        }
+    }
+    return (sink == 0) ? 1 : 0;
+}
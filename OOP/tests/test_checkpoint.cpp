@@ -0,0 +1,157 @@
+// Guarda un punto de control de un HistogramSet y un JetColumns pequenos, sigue llenando
+// como si el analisis continuara y lo carga en otros nuevos, como al reanudar tras una
+// interrupcion: los histogramas, la siguiente entrada y las filas exportadas deben ser los
+// del momento del guardado. Un estado de otra configuracion (firma) o de otro rango se
+// rechaza sin cambiar los histogramas.
+#include "../Checkpoint.cpp"
+#include "../HistogramMerger.cpp"
+#include "../HistogramRegistry.cpp"
+#include "../JetColumns.cpp"
+#include "TestHistograms.h"
+#include <vector>
+
+static const Int_t kJets = 3;
+
+static Int_t errors = 0;
+
+static void Check(const std::string& what, Long64_t value, Long64_t expected) {
+    if (value != expected) {
+        std::cerr << "Error: " << what << " = " << value << ", esperado " << expected << std::endl;
+        errors++;
+    }
+}
+
+// Llena rows jets, kJets por evento, en los histogramas y en las columnas; guarda el pT
+// de cada fila exportada en pts
+static void FillJets(Long64_t rows, std::mt19937& rng, std::vector<HistogramSet*> sets, JetColumns& columns,
+                     std::vector<Float_t>* pts) {
+    for (Long64_t row = 0; row < rows; row++) {
+        JetFeatures f = MakeJet(row % kJets, rng);
+        RadialPoint p = MakePoint(f.category, rng);
+        for (HistogramSet* set : sets) {
+            if (f.index == 0) set->FillEvent({kJets});
+            set->FillJet(f.index, f);
+            if (f.sumPT != 0.0) set->FillPoint(f.index, p);
+        }
+        columns.Add(f);
+        if (pts) pts->push_back(f.pt);
+    }
+}
+
+int main() {
+    TH1::AddDirectory(kFALSE);
+    const HistogramRegistry& registry = HistogramRegistry::Default();
+    const std::string dir = "test_checkpoint.dir";
+    const std::string spill = "test_checkpoint.part";
+    const std::string stem = "test_checkpoint.features";
+    const std::string signature = Checkpoint::Signature({"test_checkpoint"});
+    const Long64_t first = 1000, last = 9000, next = 7000;
+
+    AnalyzerConfig config;
+    config.leadingJets = kJets;
+    config.flavorSplit = true;
+    config.checkpointDir = dir;
+    if (!MakeDirectory(dir)) return 1;
+
+    // Un bloque completo en el archivo temporal y otro parcial en memoria
+    const Long64_t savedRows = JetColumns::kBlockRows + 904;
+    std::mt19937 rng(2024);
+    HistogramSet histograms(registry, config, kJets), expected(registry, config, kJets);
+    JetColumns columns(spill);
+    std::vector<Float_t> pts;
+    FillJets(savedRows, rng, {&histograms, &expected}, columns, &pts);
+
+    Checkpoint checkpoint(config, first, last, signature);
+    Checkpoint::State state;
+    state.next = next;
+    state.eventsRead = savedRows / kJets;
+    state.columnRows = columns.Rows();
+    if (!checkpoint.Save(state, histograms, &columns)) return 1;
+
+    // Lo llenado despues (con otro bloque en el archivo temporal) se pierde al reanudar
+    FillJets(JetColumns::kBlockRows, rng, {&histograms}, columns, nullptr);
+
+    HistogramSet resumed(registry, config, kJets);
+    JetColumns resumedColumns(spill, true);
+    Checkpoint resume(config, first, last, signature);
+    Checkpoint::State loaded;
+    if (!resume.Load(loaded, resumed, &resumedColumns)) {
+        std::cerr << "Error: no se pudo cargar el punto de control guardado" << std::endl;
+        errors++;
+    }
+    Check("siguiente entrada", loaded.next, next);
+    Check("eventos leidos", loaded.eventsRead, state.eventsRead);
+    Check("filas del estado", loaded.columnRows, savedRows);
+    Check("filas de las columnas", resumedColumns.Rows(), savedRows);
+
+    HistogramMerger::HistogramList expectedList, resumedList;
+    if (!ReadBack(expected, "test_checkpoint.expected.root", expectedList) ||
+        !ReadBack(resumed, "test_checkpoint.resumed.root", resumedList)) {
+        return 1;
+    }
+    errors += CountDifferences(expectedList, resumedList, "histogramas cargados");
+    Double_t expectedEntries = 0;
+    for (const TH1* h : expectedList) {
+        expectedEntries += h->GetEntries();
+    }
+    if (expectedEntries == 0) {
+        std::cerr << "Error: los histogramas guardados estan vacios" << std::endl;
+        errors++;
+    }
+
+    // La columna del pT, escrita desde las columnas cargadas, con las filas del guardado
+    if (!JetColumns::Write(stem, {&resumedColumns})) {
+        errors++;
+    } else {
+        FILE* in = std::fopen(JetColumns::ColumnPath(stem, "pt").c_str(), "rb");
+        std::vector<Float_t> column(savedRows + 1);
+        size_t rows = 0;
+        if (in && std::fseek(in, JetColumns::kHeaderBytes, SEEK_SET) == 0) {
+            rows = std::fread(column.data(), sizeof(Float_t), column.size(), in);
+        }
+        if (in) std::fclose(in);
+        Check("filas de la columna pt", rows, savedRows);
+        Long64_t differentRows = 0;
+        for (size_t row = 0; row < std::min(rows, pts.size()); row++) {
+            differentRows += column[row] != pts[row];
+        }
+        Check("filas distintas de la columna pt", differentRows, 0);
+    }
+    for (const auto& c : JetColumns::Columns()) {
+        std::remove(JetColumns::ColumnPath(stem, c.name).c_str());
+    }
+    std::remove((stem + ".columns.txt").c_str());
+
+    // Estados que no corresponden: se rechazan y los histogramas no cambian
+    HistogramSet untouched(registry, config, kJets);
+    Checkpoint otherSignature(config, first, last, Checkpoint::Signature({"otra configuracion"}));
+    Checkpoint otherRange(config, first, last + 1, signature);
+    if (otherSignature.Load(loaded, untouched, nullptr)) {
+        std::cerr << "Error: se ha cargado un punto de control de otra configuracion" << std::endl;
+        errors++;
+    }
+    if (otherRange.Load(loaded, untouched, nullptr)) {
+        std::cerr << "Error: se ha cargado un punto de control de otro rango" << std::endl;
+        errors++;
+    }
+    HistogramMerger::HistogramList untouchedList;
+    if (!ReadBack(untouched, "test_checkpoint.untouched.root", untouchedList)) return 1;
+    Double_t untouchedEntries = 0;
+    for (const TH1* h : untouchedList) {
+        untouchedEntries += h->GetEntries();
+    }
+    Check("entradas tras los rechazos", untouchedEntries, 0);
+
+    Checkpoint::RemoveAll(dir);
+    size_t nHistograms = expectedList.size();
+    HistogramMerger::Delete(expectedList);
+    HistogramMerger::Delete(resumedList);
+    HistogramMerger::Delete(untouchedList);
+    if (errors > 0) {
+        std::cerr << "Error: " << errors << " comprobaciones de los puntos de control fallidas" << std::endl;
+        return 1;
+    }
+    std::cout << "test_checkpoint: " << nHistograms << " histogramas y " << savedRows
+              << " filas recuperados; estados de otra firma u otro rango rechazados" << std::endl;
+    return 0;
+}
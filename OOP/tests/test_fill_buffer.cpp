@@ -0,0 +1,199 @@
+// Llena los histogramas de un HistogramSet con separacion por sabor de dos formas, con los
+// mismos eventos sinteticos: evento a evento (FillEvent, FillJet..., con los valores
+// acumulados y llenados con FillN cada kFillBuffer) y por lotes (FeatureBlock y Fill, con
+// los puntos del perfil radial llenados con FillPoints cuando no caben en el lote, como
+// JetAnalyzer). Las dos deben coincidir exactamente, en contenido de cada celda y en
+// entradas, con una referencia llenada valor a valor con TH1::Fill. Hay jets sin trazas y
+// sin pT parcial (condiciones HasTracks y HasTotalPT) de todas las categorias de sabor.
+#include "../HistogramMerger.cpp"
+#include "../HistogramRegistry.cpp"
+#include "TestHistograms.h"
+#include <TH2F.h>
+#include <vector>
+
+static const Int_t kJets = 3;
+static const Int_t kEvents = 3000;
+static const Int_t kBlockEvents = 64;
+static const Int_t kBlockPoints = 100;
+
+// Histogramas con los nombres y el binning de HistogramSet, llenados valor a valor
+class Reference {
+public:
+    Reference(const HistogramRegistry& registry, const AnalyzerConfig& config) {
+        Book(registry.eventObservables, config, 1);
+        Book(registry.pairObservables, config, kJets * (kJets - 1) / 2);
+        Book(registry.jetObservables, config, kJets);
+        Book(registry.pointObservables, config, kJets);
+    }
+
+    // Copia k de cada observable de defs y, si tiene, rebanada de la categoria del registro
+    template <class Record>
+    void Fill(const std::vector<Observable<Record>>& defs, Int_t k, const Record& f, Int_t category = 0) {
+        for (const auto& def : defs) {
+            auto found = fCopies.find(&def);
+            if (found == fCopies.end() || k >= found->second.n) continue;
+            if (def.when && !def.when(f)) continue;
+            const Copies& copies = found->second;
+            Fill(def, copies.histograms[k], f);
+            if (copies.split) Fill(def, copies.histograms[copies.n * (1 + category) + k], f);
+        }
+    }
+
+    HistogramMerger::HistogramList histograms;
+
+private:
+    struct Copies {
+        Int_t n;
+        bool split;
+        std::vector<TH1*> histograms;
+    };
+
+    template <class Record>
+    void Book(const std::vector<Observable<Record>>& defs, const AnalyzerConfig& config, Int_t nCopies) {
+        for (const auto& def : defs) {
+            if (!config.IsEnabled(def.name)) continue;
+            Copies copies;
+            copies.n = (def.maxJets > 0 && def.scope != kPairScope) ? std::min(def.maxJets, nCopies) : nCopies;
+            copies.split = config.flavorSplit && HistogramSet::Splittable(def);
+            Int_t total = copies.split ? copies.n * (1 + kFlavorCategories) : copies.n;
+            for (Int_t s = 0; s < total; s++) {
+                Int_t k = s % copies.n;
+                Int_t c = s / copies.n - 1;
+                TString name = (c < 0) ? HistogramSet::CopyName(def, k) : HistogramSet::SliceName(def, k, c);
+                TH1* h = def.Is2D() ? (TH1*)new TH2F(name, name, def.nbinsX, def.xlow, def.xup, def.nbinsY, def.ylow, def.yup)
+                                    : (TH1*)new TH1F(name, name, def.nbinsX, def.xlow, def.xup);
+                copies.histograms.push_back(h);
+                histograms.push_back(h);
+            }
+            fCopies[&def] = copies;
+        }
+    }
+
+    template <class Record>
+    static void Fill(const Observable<Record>& def, TH1* h, const Record& f) {
+        if (def.y) {
+            static_cast<TH2*>(h)->Fill(def.x(f), def.y(f));
+        } else {
+            h->Fill(def.x(f));
+        }
+    }
+
+    std::map<const ObservableInfo*, Copies> fCopies;
+};
+
+// Entradas del histograma name de una lista (-1 si no esta)
+static Double_t Entries(const HistogramMerger::HistogramList& histograms, const std::string& name) {
+    for (const TH1* h : histograms) {
+        if (name == h->GetName()) return h->GetEntries();
+    }
+    return -1;
+}
+
+int main() {
+    TH1::AddDirectory(kFALSE);
+    const HistogramRegistry& registry = HistogramRegistry::Default();
+    AnalyzerConfig config;
+    config.leadingJets = kJets;
+    config.flavorSplit = true;
+
+    HistogramSet perEvent(registry, config, kJets), blocks(registry, config, kJets);
+    Reference reference(registry, config);
+    FeatureBlock block(kBlockEvents, kJets, kBlockPoints);
+
+    // Jets del primer jet principal que cumplen HasTracks y HasTotalPT, en total y por categoria
+    Long64_t withTracks[1 + kFlavorCategories] = {}, withTotal[1 + kFlavorCategories] = {};
+
+    std::mt19937 rng(31);
+    std::uniform_real_distribution<Double_t> u(0, 1);
+    for (Int_t event = 0; event < kEvents; event++) {
+        // Eventos con menos jets que jets principales: las copias de los ultimos se llenan menos
+        Int_t nJets = 1 + rng() % kJets;
+        EventFeatures ev = {nJets};
+        perEvent.FillEvent(ev);
+        block.events.push_back(ev);
+        reference.Fill(registry.eventObservables, 0, ev);
+
+        for (Int_t i = 0; i < nJets; i++) {
+            for (Int_t j = i + 1; j < nJets; j++) {
+                Int_t pair = HistogramSet::PairIndex(i, j, kJets);
+                PairFeatures p = {7 * u(rng)};
+                perEvent.FillPair(pair, p);
+                block.pairs[pair].push_back(p);
+                reference.Fill(registry.pairObservables, pair, p);
+            }
+        }
+
+        for (Int_t i = 0; i < nJets; i++) {
+            JetFeatures f = MakeJet(i, rng);
+            perEvent.FillJet(i, f);
+            block.jets[i].push_back(f);
+            reference.Fill(registry.jetObservables, i, f, f.category);
+            if (i == 0) {
+                for (Int_t c : {-1, f.category}) {
+                    withTracks[1 + c] += (f.sumPT != 0.0);
+                    withTotal[1 + c] += (f.sumPT != 0.0 && f.totalPT != 0);
+                }
+            }
+            if (f.sumPT == 0.0) continue;
+
+            Int_t nPoints = rng() % 40;
+            for (Int_t k = 0; k < nPoints; k++) {
+                RadialPoint p = MakePoint(f.category, rng);
+                perEvent.FillPoint(i, p);
+                if (block.PointsFull(i)) {
+                    blocks.FillPoints(i, block.points[i]);
+                    block.points[i].clear();
+                }
+                block.points[i].push_back(p);
+                reference.Fill(registry.pointObservables, i, p, f.category);
+            }
+        }
+
+        if ((Int_t)block.events.size() == kBlockEvents) {
+            blocks.Fill(block);
+            block.Clear();
+        }
+    }
+    blocks.Fill(block);
+
+    Long64_t errors = 0;
+    HistogramMerger::HistogramList perEventList, blocksList;
+    if (!ReadBack(perEvent, "test_fill_buffer.events.root", perEventList) ||
+        !ReadBack(blocks, "test_fill_buffer.blocks.root", blocksList)) {
+        return 1;
+    }
+    errors += CountDifferences(reference.histograms, perEventList, "evento a evento");
+    errors += CountDifferences(reference.histograms, blocksList, "por lotes");
+
+    // Las condiciones de llenado, contadas aparte: R50 solo con trazas y las fracciones de
+    // pT solo con pT parcial, en la copia inclusiva y en cada rebanada
+    for (Int_t c = -1; c < kFlavorCategories; c++) {
+        std::string suffix = (c < 0) ? "" : std::string("_") + FlavorCategoryName(c);
+        for (const auto* list : {&perEventList, &blocksList}) {
+            Double_t r50 = Entries(*list, "hR50PercentPT0" + suffix);
+            Double_t fraction = Entries(*list, "hChargedPTFraction0" + suffix);
+            if (r50 != withTracks[1 + c] || fraction != withTotal[1 + c]) {
+                std::cerr << "Error: hR50PercentPT0" << suffix << " con " << r50 << " entradas y hChargedPTFraction0"
+                          << suffix << " con " << fraction << ", esperadas " << withTracks[1 + c] << " y "
+                          << withTotal[1 + c] << std::endl;
+                errors++;
+            }
+        }
+        if (withTracks[1 + c] == 0 || withTotal[1 + c] == withTracks[1 + c]) {
+            std::cerr << "Error: la muestra no cubre las condiciones de llenado en la categoria " << c << std::endl;
+            errors++;
+        }
+    }
+
+    size_t nHistograms = reference.histograms.size();
+    HistogramMerger::Delete(reference.histograms);
+    HistogramMerger::Delete(perEventList);
+    HistogramMerger::Delete(blocksList);
+    if (errors > 0) {
+        std::cerr << "Error: " << errors << " comprobaciones del llenado fallidas" << std::endl;
+        return 1;
+    }
+    std::cout << "test_fill_buffer: " << nHistograms << " histogramas de " << kEvents
+              << " eventos identicos evento a evento, por lotes y valor a valor" << std::endl;
+    return 0;
+}
@@ -0,0 +1,73 @@
+// Compara RadialProfile::Sort con std::stable_sort por DeltaR: jets vacios, de una sola
+// particula, alrededor del limite de la insercion directa (kSmall) y con muchas
+// particulas, con DeltaR repetidos (empates dentro y entre cubetas), en los bordes de
+// las cubetas y fuera del cono. El orden de las particulas debe coincidir exactamente.
+#include "../RadialProfile.h"
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// Como ParticleInfo de JetAnalyzer: indice de traza, DeltaR y pT
+struct Particle {
+    Int_t index;
+    Double_t deltaR;
+    Double_t pt;
+};
+
+// DeltaR de la particula k segun el tipo de jet
+static Double_t MakeDeltaR(Int_t kind, Int_t k, std::mt19937& rng) {
+    std::uniform_real_distribution<Double_t> cone(0, RadialProfile::kMaxDeltaR);
+    const Double_t width = RadialProfile::kMaxDeltaR / RadialProfile::kBuckets;
+    switch (kind) {
+        case 0: return cone(rng);                                            // Todos distintos
+        case 1: return 0.1 * (rng() % 4);                                    // Pocos valores: muchos empates
+        case 2: return width * (rng() % (RadialProfile::kBuckets + 1));      // Bordes de las cubetas
+        case 3: return (k % 2) ? 0.2 : 0.2 + 1e-12;                          // Empates en la misma cubeta
+        default: return (rng() % 5 == 0) ? 0.45 + 0.01 * (rng() % 3) : 0.0; // Fuera del cono y en el eje
+    }
+}
+
+int main() {
+    const Int_t sizes[] = {0, 1, 2, 3, 15, 16, 17, 18, 33, 64, 65, 200, 1000};
+    const Int_t kKinds = 5;
+    const Int_t kJetsPerCase = 50;
+    std::mt19937 rng(777);
+
+    Long64_t jets = 0, errors = 0;
+    std::vector<Particle> particles, expected, scratch;
+    for (Int_t n : sizes) {
+        for (Int_t kind = 0; kind < kKinds; kind++) {
+            for (Int_t k = 0; k < kJetsPerCase; k++) {
+                particles.clear();
+                for (Int_t j = 0; j < n; j++) {
+                    particles.push_back({j, MakeDeltaR(kind, j, rng), 1.0 + j});
+                }
+                expected = particles;
+                std::stable_sort(expected.begin(), expected.end(),
+                                 [](const Particle& a, const Particle& b) { return a.deltaR < b.deltaR; });
+                scratch.resize(n);
+                RadialProfile::Sort(particles.data(), n, scratch.data());
+                jets++;
+
+                for (Int_t j = 0; j < n; j++) {
+                    if (particles[j].index != expected[j].index) {
+                        if (errors < 10) {
+                            std::cerr << "Error: " << n << " particulas (tipo " << kind << "), posicion " << j
+                                      << ": indice " << particles[j].index << ", esperado " << expected[j].index
+                                      << std::endl;
+                        }
+                        errors++;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+    if (errors > 0) {
+        std::cerr << "Error: " << errors << " de " << jets << " jets con un orden distinto de std::stable_sort" << std::endl;
+        return 1;
+    }
+    std::cout << "test_radial_sort: " << jets << " jets, mismo orden que std::stable_sort" << std::endl;
+    return 0;
+}
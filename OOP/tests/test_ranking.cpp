@@ -0,0 +1,132 @@
+// Comprueba las metricas de DiscriminationRanking en histogramas pequenos hechos a mano,
+// con la separacion, la distancia y el AUC calculados a mano: separacion perfecta, dos
+// distribuciones iguales, un caso intermedio, desbordamientos, un histograma vacio y un 2D
+// (variacion total y AUC del mejor orden). Tambien el orden de Rank (1D antes que 2D) y
+// las dos tablas de Write.
+#include "../DiscriminationRanking.cpp"
+#include "../HistogramMerger.cpp"
+#include <TH1D.h>
+#include <TH2D.h>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+static Int_t errors = 0;
+
+static void Check(const std::string& what, Double_t value, Double_t expected) {
+    if (std::fabs(value - expected) > 1e-12) {
+        std::cerr << "Error: " << what << " = " << value << ", esperado " << expected << std::endl;
+        errors++;
+    }
+}
+
+static void CheckCut(const std::string& what, const std::string& cut, const std::string& expected) {
+    if (cut != expected) {
+        std::cerr << "Error: corte de " << what << " '" << cut << "', esperado '" << expected << "'" << std::endl;
+        errors++;
+    }
+}
+
+static void CheckMetrics(const DiscriminationRanking::Metrics& m, Int_t dimension, const std::string& cut,
+                         Double_t separation, Double_t distance, Double_t auc) {
+    Check(m.name + " dimension", m.dimension, dimension);
+    CheckCut(m.name, m.cut, cut);
+    Check(m.name + " separacion", m.separation, separation);
+    Check(m.name + " distancia", m.distance, distance);
+    Check(m.name + " AUC", m.auc, auc);
+}
+
+// Histograma 1D de 4 bins en [0, 4) con el contenido de los bins 0 (desbordamiento
+// inferior) a 5 (superior)
+static TH1D* Make1D(const char* name, std::vector<Double_t> contents) {
+    TH1D* h = new TH1D(name, name, 4, 0, 4);
+    for (Int_t bin = 0; bin < (Int_t)contents.size(); bin++) {
+        h->SetBinContent(bin, contents[bin]);
+    }
+    h->SetEntries(1);
+    return h;
+}
+
+int main() {
+    TH1::AddDirectory(kFALSE);
+
+    // Senal en los valores altos y fondo en los bajos: separacion, KS y AUC maximos con x > c
+    TH1D* perfectS = Make1D("perfect", {0, 0, 0, 1, 1, 0});
+    TH1D* perfectB = Make1D("perfect", {0, 1, 1, 0, 0, 0});
+    CheckMetrics(DiscriminationRanking::Compute(*perfectS, *perfectB), 1, ">", 1, 1, 1);
+
+    // Iguales: nada separa (AUC de un corte al azar)
+    TH1D* sameS = Make1D("same", {0, 1, 1, 1, 1, 0});
+    TH1D* sameB = Make1D("same", {0, 2, 2, 2, 2, 0});
+    CheckMetrics(DiscriminationRanking::Compute(*sameS, *sameB), 1, "<", 0, 0, 0.5);
+
+    // s = (1/4, 1/2, 1/4, 0), b = (0, 1/4, 1/2, 1/4): <S^2> = 1/3, KS = 1/2, AUC (x < c) = 13/16
+    TH1D* middleS = Make1D("middle", {0, 1, 2, 1, 0, 0});
+    TH1D* middleB = Make1D("middle", {0, 0, 1, 2, 1, 0});
+    CheckMetrics(DiscriminationRanking::Compute(*middleS, *middleB), 1, "<", 1.0 / 3, 0.5, 13.0 / 16);
+
+    // Los desbordamientos cuentan, en los extremos del eje
+    TH1D* overflowS = Make1D("overflow", {0, 0, 0, 0, 0, 3});
+    TH1D* overflowB = Make1D("overflow", {3, 0, 0, 0, 0, 0});
+    CheckMetrics(DiscriminationRanking::Compute(*overflowS, *overflowB), 1, ">", 1, 1, 1);
+
+    // Vacio: las metricas de dos histogramas iguales, sin corte
+    TH1D* emptyS = Make1D("empty", {0, 0, 0, 0, 0, 0});
+    TH1D* emptyB = Make1D("empty", {0, 1, 1, 0, 0, 0});
+    CheckMetrics(DiscriminationRanking::Compute(*emptyS, *emptyB), 1, "-", 0, 0, 0.5);
+
+    // 2D: s = (1/2, 1/4, 1/4, 0) y b = (0, 1/4, 1/4, 1/2) en cuatro celdas, de fraccion de
+    // senal 1, 1/2, 1/2 y 0. <S^2> = 1/2, variacion total 1/2, AUC del mejor orden 7/8
+    TH2D* gridS = new TH2D("grid", "grid", 2, 0, 2, 2, 0, 2);
+    TH2D* gridB = new TH2D("grid", "grid", 2, 0, 2, 2, 0, 2);
+    const Double_t s[] = {2, 1, 1, 0}, b[] = {0, 1, 1, 2};
+    for (Int_t k = 0; k < 4; k++) {
+        gridS->SetBinContent(gridS->GetBin(1 + k % 2, 1 + k / 2), s[k]);
+        gridB->SetBinContent(gridB->GetBin(1 + k % 2, 1 + k / 2), b[k]);
+    }
+    CheckMetrics(DiscriminationRanking::Compute(*gridS, *gridB), 2, "s/(s+b)", 0.5, 0.5, 7.0 / 8);
+
+    // Rank: primero los 1D por separacion y despues los 2D, aunque separen mas que algun 1D
+    std::vector<std::pair<const TH1*, const TH1*>> pairs = {
+        {gridS, gridB}, {sameS, sameB}, {perfectS, perfectB}, {middleS, middleB}};
+    std::vector<DiscriminationRanking::Metrics> ranking = DiscriminationRanking::Rank(pairs, 2);
+    const char* order[] = {"perfect", "middle", "same", "grid"};
+    for (size_t k = 0; k < ranking.size(); k++) {
+        if (ranking[k].name != order[k]) {
+            std::cerr << "Error: posicion " << k + 1 << " de Rank: " << ranking[k].name << ", esperado " << order[k]
+                      << std::endl;
+            errors++;
+        }
+    }
+
+    // Write: una tabla por dimension, cada una numerada desde 1
+    std::string path = "test_ranking.txt";
+    if (!DiscriminationRanking::Write(ranking, path)) {
+        errors++;
+    } else {
+        std::ifstream in(path);
+        std::stringstream text;
+        text << in.rdbuf();
+        std::string table = text.str();
+        size_t table2D = table.find("# Histogramas 2D");
+        if (table2D == std::string::npos || table.find("\n1 perfect >") > table2D ||
+            table.find("variacion_total auc_optima") < table2D || table.find("\n1 grid s/(s+b)") < table2D) {
+            std::cerr << "Error: tablas de Write inesperadas:\n" << table << std::endl;
+            errors++;
+        }
+        std::remove(path.c_str());
+    }
+
+    for (TH1* h : std::vector<TH1*>{perfectS, perfectB, sameS, sameB, middleS, middleB, overflowS, overflowB,
+                                     emptyS, emptyB, gridS, gridB}) {
+        delete h;
+    }
+    if (errors > 0) {
+        std::cerr << "Error: " << errors << " comprobaciones de la clasificacion fallidas" << std::endl;
+        return 1;
+    }
+    std::cout << "test_ranking: metricas, orden y tablas de la clasificacion correctos" << std::endl;
+    return 0;
+}
@@ -0,0 +1,116 @@
+// Compara la asignacion de trazas al cono de los jets con la rejilla eta-phi (EtaPhiGrid y
+// el DeltaR^2 de las candidatas) frente al kernel denso de TrackBuffer, el de
+// JetAnalyzer::MatchTracks. Para cada jet, las trazas dentro del cono y su DeltaR^2 deben
+// coincidir bit a bit. Los eventos son aleatorios (semilla fija) con casos limite: phi en
+// +-pi, eta fuera de la rejilla, trazas no finitas y jets centrados en una traza.
+#include "../EtaPhiGrid.h"
+#include "../EventArena.h"
+#include "../TrackBuffer.h"
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+static constexpr Float_t kConeR2 = 0.4f * 0.4f; // Como en JetAnalyzer
+static constexpr Int_t kJets = 8;
+
+struct Event {
+    std::vector<Float_t> pt, eta, phi, d0, dz;
+    std::vector<Int_t> charge;
+    std::vector<Float_t> jetEta, jetPhi;
+};
+
+static Event MakeEvent(Int_t nTracks, std::mt19937& rng) {
+    std::uniform_real_distribution<Float_t> eta(-4.5f, 4.5f);
+    std::uniform_real_distribution<Float_t> phi(-TMath::Pi(), TMath::Pi());
+    std::uniform_real_distribution<Float_t> unit(0.f, 1.f);
+    const Float_t nan = std::numeric_limits<Float_t>::quiet_NaN();
+    const Float_t edges[] = {(Float_t)TMath::Pi(), -(Float_t)TMath::Pi(), 6.f, -6.f, nan};
+
+    Event e;
+    for (Int_t j = 0; j < nTracks; j++) {
+        Float_t u = unit(rng);
+        e.eta.push_back(u < 0.02f ? edges[2 + j % 3] : eta(rng));
+        e.phi.push_back(u > 0.98f ? edges[j % 2] : phi(rng));
+        e.pt.push_back(1 + 50 * unit(rng));
+        e.d0.push_back(unit(rng));
+        e.dz.push_back(unit(rng));
+        e.charge.push_back(j % 3 - 1);
+    }
+    // Jets en posiciones aleatorias, en el borde de phi y de eta, y sobre una traza
+    for (Int_t i = 0; i < kJets; i++) {
+        Float_t jetEta = eta(rng), jetPhi = phi(rng);
+        if (i == 1) jetPhi = edges[0] - 0.05f;
+        if (i == 2) jetPhi = edges[1] + 0.05f;
+        if (i == 3) jetEta = 4.9f;
+        if (i >= 4 && nTracks > 0) {
+            Int_t j = rng() % nTracks;
+            if (std::isfinite(e.eta[j]) && std::isfinite(e.phi[j])) {
+                jetEta = e.eta[j] + 0.1f * (unit(rng) - 0.5f);
+                jetPhi = e.phi[j];
+            }
+        }
+        e.jetEta.push_back(jetEta);
+        e.jetPhi.push_back(jetPhi);
+    }
+    return e;
+}
+
+// Numero de diferencias entre las dos asignaciones del evento
+static Int_t CompareEvent(const Event& e, TrackBuffer& tracks, EventArena& arena, EtaPhiGrid& grid) {
+    Int_t n = e.eta.size();
+    tracks.Fill(n, e.pt.data(), e.eta.data(), e.phi.data(), e.charge.data(), e.d0.data(), e.dz.data());
+    arena.Reset();
+    grid.Build(n, tracks.eta, tracks.phi, arena);
+    Int_t* candidates = arena.Allocate<Int_t>(n);
+    // Fila alineada de TrackBuffer para el kernel denso
+    Float_t* dense = tracks.DeltaR2(0);
+    std::vector<Float_t> sparse(n);
+
+    Int_t errors = 0;
+    for (Int_t i = 0; i < kJets; i++) {
+        tracks.ComputeDeltaR2(e.jetEta[i], e.jetPhi[i], dense);
+        Int_t nCandidates = grid.Query(e.jetEta[i], e.jetPhi[i], candidates);
+        tracks.ComputeDeltaR2(e.jetEta[i], e.jetPhi[i], candidates, nCandidates, sparse.data());
+        for (Int_t j = 0; j < n; j++) {
+            bool inDense = dense[j] < kConeR2;
+            bool inGrid = sparse[j] < kConeR2;
+            if (inDense != inGrid || (inDense && std::memcmp(&dense[j], &sparse[j], sizeof(Float_t)) != 0)) {
+                if (errors < 10) {
+                    std::cerr << "Error: " << n << " trazas, jet " << i << " (" << e.jetEta[i] << ", " << e.jetPhi[i]
+                              << "), traza " << j << " (" << e.eta[j] << ", " << e.phi[j] << "): DeltaR^2 denso "
+                              << dense[j] << ", rejilla " << sparse[j] << std::endl;
+                }
+                errors++;
+            }
+        }
+    }
+    return errors;
+}
+
+int main() {
+    const Int_t sizes[] = {0, 1, 7, 8, 9, 31, 64, 163, 500, 2048};
+    const Int_t kEventsPerSize = 200;
+    std::mt19937 rng(12345);
+
+    TrackBuffer tracks;
+    EventArena arena;
+    EtaPhiGrid grid;
+    tracks.Reserve(2048, kJets);
+    arena.Reserve(3 * EventArena::Bytes<Int_t>(2048));
+
+    Long64_t errors = 0, events = 0;
+    for (Int_t n : sizes) {
+        for (Int_t k = 0; k < kEventsPerSize; k++) {
+            errors += CompareEvent(MakeEvent(n, rng), tracks, arena, grid);
+            events++;
+        }
+    }
+    if (errors > 0) {
+        std::cerr << "Error: " << errors << " asignaciones distintas entre la rejilla y el kernel denso" << std::endl;
+        return 1;
+    }
+    std::cout << "test_track_matching: " << events << " eventos, rejilla y kernel denso identicos" << std::endl;
+    return 0;
+}